@@ -9,9 +9,11 @@ MOC_DIR = moc
 
 SOURCES += \
     src/engine/Engine.cpp \
+    src/engine/StateJournal.cpp \
     src/engine/city/City.cpp \
     src/engine/city/PopulationHandler.cpp \
     src/engine/loader/CityLoader.cpp \
+    src/engine/loader/CitySnapshot.cpp \
     src/engine/map/dynamicElement/character/Character.cpp \
     src/engine/map/dynamicElement/character/DeliveryManCharacter.cpp \
     src/engine/map/dynamicElement/character/ImmigrantCharacter.cpp \
@@ -21,6 +23,8 @@ SOURCES += \
     src/engine/map/dynamicElement/DynamicElementFactory.cpp \
     src/engine/map/dynamicElement/DynamicElementRegistry.cpp \
     src/engine/map/dynamicElement/MotionHandler.cpp \
+    src/engine/map/dynamicElement/MotionKernel.cpp \
+    src/engine/map/dynamicElement/MotionStore.cpp \
     src/engine/map/path/algorithm/PathFinder.cpp \
     src/engine/map/path/algorithm/RegisteredTileBag.cpp \
     src/engine/map/path/PathGenerator.cpp \
@@ -50,6 +54,8 @@ SOURCES += \
     src/engine/processing/AbstractProcessable.cpp \
     src/engine/processing/CycleDate.cpp \
     src/engine/processing/TimeCycleProcessor.cpp \
+    src/engine/simulation/CitySimulation.cpp \
+    src/engine/simulation/SimulationHost.cpp \
     src/exceptions/BadConfigurationException.cpp \
     src/exceptions/EngineException.cpp \
     src/exceptions/Exception.cpp \
@@ -78,8 +84,10 @@ SOURCES += \
     src/ui/BuildingDetailsDialog.cpp \
     src/ui/InformationWidget.cpp \
     src/ui/MainWindow.cpp \
+    src/ui/MiniMap.cpp \
     src/viewer/construction/ConstructionCursor.cpp \
-    src/viewer/element/graphics/DynamicElement.cpp \
+    src/viewer/element/graphics/CharacterBatch.cpp \
+    src/viewer/element/graphics/ImageItem.cpp \
     src/viewer/element/graphics/StaticElement.cpp \
     src/viewer/element/BuildingView.cpp \
     src/viewer/element/CharacterView.cpp \
@@ -87,21 +95,26 @@ SOURCES += \
     src/viewer/image/BuildingImage.cpp \
     src/viewer/image/CharacterImage.cpp \
     src/viewer/image/Image.cpp \
+    src/viewer/image/ImageAtlas.cpp \
     src/viewer/image/ImageLibrary.cpp \
     src/viewer/image/ImageSequence.cpp \
     src/viewer/image/NatureElementImage.cpp \
+    src/viewer/GroundChunk.cpp \
     src/viewer/MapScene.cpp \
     src/viewer/Positioning.cpp \
+    src/viewer/TileChunk.cpp \
     src/viewer/TileView.cpp \
     src/main.cpp
 
 HEADERS += \
     src/engine/Engine.hpp \
+    src/engine/StateJournal.hpp \
     src/engine/city/City.hpp \
     src/engine/city/PopulationHandler.hpp \
     src/engine/city/PopulationRegistryInterface.hpp \
     src/engine/city/WorkingPlaceRegistryInterface.hpp \
     src/engine/loader/CityLoader.hpp \
+    src/engine/loader/CitySnapshot.hpp \
     src/engine/map/dynamicElement/character/Character.hpp \
     src/engine/map/dynamicElement/character/DeliveryManCharacter.hpp \
     src/engine/map/dynamicElement/character/ImmigrantCharacter.hpp \
@@ -113,6 +126,8 @@ HEADERS += \
     src/engine/map/dynamicElement/DynamicElementFactory.hpp \
     src/engine/map/dynamicElement/DynamicElementRegistry.hpp \
     src/engine/map/dynamicElement/MotionHandler.hpp \
+    src/engine/map/dynamicElement/MotionKernel.hpp \
+    src/engine/map/dynamicElement/MotionStore.hpp \
     src/engine/map/path/algorithm/PathFinder.hpp \
     src/engine/map/path/algorithm/RegisteredTileBag.hpp \
     src/engine/map/path/PathGenerator.hpp \
@@ -124,6 +139,7 @@ HEADERS += \
     src/engine/map/staticElement/building/AbstractBuilding.hpp \
     src/engine/map/staticElement/building/AbstractProcessableBuilding.hpp \
     src/engine/map/staticElement/building/AbstractStoringBuilding.hpp \
+    src/engine/map/staticElement/building/BuildingResolverInterface.hpp \
     src/engine/map/staticElement/building/BuildingSearchEngine.hpp \
     src/engine/map/staticElement/building/CivilianEntryPoint.hpp \
     src/engine/map/staticElement/building/FarmBuilding.hpp \
@@ -146,6 +162,8 @@ HEADERS += \
     src/engine/processing/AbstractProcessable.hpp \
     src/engine/processing/CycleDate.hpp \
     src/engine/processing/TimeCycleProcessor.hpp \
+    src/engine/simulation/CitySimulation.hpp \
+    src/engine/simulation/SimulationHost.hpp \
     src/exceptions/BadConfigurationException.hpp \
     src/exceptions/EngineException.hpp \
     src/exceptions/Exception.hpp \
@@ -153,6 +171,8 @@ HEADERS += \
     src/exceptions/NotImplementedException.hpp \
     src/exceptions/OutOfRangeException.hpp \
     src/exceptions/UnexpectedException.hpp \
+    src/global/concurrency/SpscQueue.hpp \
+    src/global/concurrency/TripleBuffer.hpp \
     src/global/conf/BuildingAreaInformation.hpp \
     src/global/conf/BuildingInformation.hpp \
     src/global/conf/CharacterInformation.hpp \
@@ -167,13 +187,15 @@ HEADERS += \
     src/global/geometry/TileArea.hpp \
     src/global/geometry/TileAreaSize.hpp \
     src/global/geometry/TileCoordinates.hpp \
-    src/global/pointer/SmartPointerUtils.hpp \
+    src/global/pointer/Handle.hpp \
+    src/global/pointer/ObjectPool.hpp \
     src/global/state/BuildingState.hpp \
     src/global/state/CharacterState.hpp \
     src/global/state/CityState.hpp \
     src/global/state/MapState.hpp \
     src/global/state/NatureElementState.hpp \
     src/global/state/State.hpp \
+    src/global/state/StateDelta.hpp \
     src/global/BuildingStatus.hpp \
     src/global/CharacterStatus.hpp \
     src/global/Direction.hpp \
@@ -184,10 +206,12 @@ HEADERS += \
     src/ui/DialogDisplayer.hpp \
     src/ui/InformationWidget.hpp \
     src/ui/MainWindow.hpp \
+    src/ui/MiniMap.hpp \
     src/viewer/construction/AreaCheckerInterface.hpp \
     src/viewer/construction/ConstructionCursor.hpp \
     src/viewer/construction/RoadPathGeneratorInterface.hpp \
-    src/viewer/element/graphics/DynamicElement.hpp \
+    src/viewer/element/graphics/CharacterBatch.hpp \
+    src/viewer/element/graphics/ImageItem.hpp \
     src/viewer/element/graphics/StaticElement.hpp \
     src/viewer/element/BuildingView.hpp \
     src/viewer/element/CharacterView.hpp \
@@ -196,14 +220,21 @@ HEADERS += \
     src/viewer/image/BuildingImage.hpp \
     src/viewer/image/CharacterImage.hpp \
     src/viewer/image/Image.hpp \
+    src/viewer/image/ImageAtlas.hpp \
     src/viewer/image/ImageLibrary.hpp \
     src/viewer/image/ImageSequence.hpp \
     src/viewer/image/NatureElementImage.hpp \
+    src/viewer/GroundChunk.hpp \
     src/viewer/MapScene.hpp \
     src/viewer/Positioning.hpp \
+    src/viewer/TileChunk.hpp \
     src/viewer/TileView.hpp \
     src/defines.hpp
 
+# The motion kernel uses SSE2 on x86 by default. Run qmake with "CONFIG+=avx2" to build the AVX2 kernel instead.
+unix: avx2: QMAKE_CXXFLAGS += -mavx2
+win32: avx2: QMAKE_CXXFLAGS += /arch:AVX2
+
 unix: CONFIG += link_pkgconfig
 unix: PKGCONFIG += yaml-cpp
 
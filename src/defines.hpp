@@ -26,6 +26,11 @@ template<class T> using optional = T;
  */
 #define BUILDING_CYCLES_PER_SECOND 1
 
+/**
+ * The maximum quantity of item types in the configuration. Stocks are fixed-size arrays indexed by item type.
+ */
+#define MAX_ITEM_TYPES 32
+
 
 
 // *** Debug feature toggle *** //
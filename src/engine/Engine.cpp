@@ -2,125 +2,219 @@
 
 #include <cassert>
 
-#include "src/engine/city/City.hpp"
 #include "src/engine/loader/CityLoader.hpp"
+#include "src/engine/loader/CitySnapshot.hpp"
+#include "src/engine/simulation/CitySimulation.hpp"
+
+/**
+ * The interval between two checks for a new state delta, in milliseconds. It roughly matches the display refresh rate.
+ */
+const int STATE_POLLING_INTERVAL(16);
 
 
 
 Engine::Engine(const Conf& conf) :
     conf(conf),
-    city(nullptr)
+    simulationThread(),
+    simulation(nullptr),
+    stateClock(),
+    speedRatio(1.0)
 {
-
+    simulationThread.setObjectName("Simulation");
 }
 
 
 
 Engine::~Engine()
 {
-    if (city) {
-        delete city;
-    }
+    unloadCity();
 }
 
 
 
 void Engine::loadCity(const QString& cityFilePath)
 {
-    if (city) {
-        delete city;
+    // The city is loaded on the GUI thread, before the simulation thread starts.
+    owner<CitySimulation*> loadedSimulation;
+    if (CitySnapshot::isSnapshot(cityFilePath)) {
+        loadedSimulation = new CitySimulation(conf, CitySnapshot::load(cityFilePath));
     }
+    else {
+        CityLoader loader(cityFilePath);
+        loadedSimulation = new CitySimulation(conf, loader);
+    }
+
+    unloadCity();
+    simulation = loadedSimulation;
+    speedRatio = simulation->getCity().getProcessor().getSpeedRatio();
+
+    simulation->moveTo(simulationThread);
+    simulationThread.start();
+    stateClock.start(STATE_POLLING_INTERVAL, this);
+}
+
+
 
-    CityLoader loader(cityFilePath);
-    city = new City(conf, loader);
+void Engine::saveCity(const QString& filePath) const
+{
+    assert(simulation != nullptr);
 
-    connect(&city->getProcessor(), &TimeCycleProcessor::processFinished, [this]() {
-        emit stateUpdated(getCurrentState());
+    CitySnapshot snapshot;
+    simulation->sendCommandAndWait([&snapshot](CitySimulation& simulation) {
+        simulation.getCity().save(snapshot);
     });
+    snapshot.save(filePath);
 }
 
 
 
 MapState Engine::getMapState() const
 {
-    assert(city != nullptr);
+    assert(simulation != nullptr);
 
-    return city->getMapState();
+    return simulation->getMapState();
 }
 
 
 
-State Engine::getCurrentState() const
+const State& Engine::getInitialState() const
 {
-    assert(city != nullptr);
+    assert(simulation != nullptr);
 
-    return {
-        city->getCurrentState(),
-        city->getNatureElementsState(),
-        city->getBuildingsState(),
-        city->getCharactersState(),
-    };
+    return simulation->getInitialState();
 }
 
 
 
-bool Engine::isConstructible(const TileArea& area) const
+void Engine::requestConstructibilityCheck(const TileArea& area)
 {
-    assert(city != nullptr);
-
-    return city->isAreaConstructible(area);
+    assert(simulation != nullptr);
+
+    // The answer is queued back to the GUI thread. The engine outlives the simulation thread, whose pending answers
+    // are dropped with the engine.
+    simulation->sendCommand([this, area](CitySimulation& simulation) {
+        auto isConstructible(simulation.getCity().isAreaConstructible(area));
+        QMetaObject::invokeMethod(this, [this, area, isConstructible]() {
+            emit constructibilityChecked(area, isConstructible);
+        }, Qt::QueuedConnection);
+    });
 }
 
 
 
-QList<TileCoordinates> Engine::getShortestPathForRoad(const TileCoordinates& origin, const TileCoordinates& target) const
+void Engine::requestShortestPathForRoad(const TileCoordinates& origin, const TileCoordinates& target)
 {
-    assert(city != nullptr);
+    assert(simulation != nullptr);
 
-    return city->getShortestPathForRoad(origin, target);
+    simulation->sendCommand([this, origin, target](CitySimulation& simulation) {
+        auto path(simulation.getCity().getShortestPathForRoad(origin, target));
+        QMetaObject::invokeMethod(this, [this, origin, target, path]() {
+            emit shortestPathForRoadGenerated(origin, target, path);
+        }, Qt::QueuedConnection);
+    });
 }
 
 
 
 void Engine::pause(const bool pause)
 {
-    assert(city != nullptr);
+    assert(simulation != nullptr);
 
-    city->getProcessor().pause(pause);
+    simulation->sendCommand([pause](CitySimulation& simulation) {
+        simulation.getCity().getProcessor().pause(pause);
+    });
 }
 
 
 
 void Engine::setProcessorSpeedRatio(const qreal speedRatio)
 {
-    assert(city != nullptr);
+    assert(simulation != nullptr);
 
-    city->getProcessor().setSpeedRatio(speedRatio);
+    this->speedRatio = speedRatio;
+    simulation->sendCommand([speedRatio](CitySimulation& simulation) {
+        simulation.getCity().getProcessor().setSpeedRatio(speedRatio);
+    });
 }
 
 
 
 qreal Engine::getProcessorSpeedRatio() const
 {
-    assert(city != nullptr);
-
-    return city->getProcessor().getSpeedRatio();
+    return speedRatio;
 }
 
 
 
 void Engine::forceNextProcess()
 {
-    assert(city != nullptr);
+    assert(simulation != nullptr);
 
-    city->getProcessor().forceNextProcess();
+    simulation->sendCommand([](CitySimulation& simulation) {
+        simulation.getCity().getProcessor().forceNextProcess();
+    });
 }
 
 
 
 void Engine::createBuilding(const BuildingInformation& type, const TileCoordinates& leftCorner, Direction orientation)
 {
-    assert(city != nullptr);
+    assert(simulation != nullptr);
+
+    auto typePointer(&type);
+    simulation->sendCommand([typePointer, leftCorner, orientation](CitySimulation& simulation) {
+        simulation.getCity().createBuilding(*typePointer, leftCorner, orientation);
+    });
+}
+
+
+
+void Engine::acknowledgeState(const int version)
+{
+    assert(simulation != nullptr);
+
+    simulation->sendCommand([version](CitySimulation& simulation) {
+        simulation.acknowledgeState(version);
+    });
+}
+
+
+
+void Engine::requestFullResync()
+{
+    assert(simulation != nullptr);
+
+    simulation->sendCommand([](CitySimulation& simulation) {
+        simulation.requestFullResync();
+    });
+}
+
+
+
+void Engine::timerEvent(QTimerEvent* /*event*/)
+{
+    if (simulation && simulation->updateStateDelta()) {
+        emit stateUpdated(simulation->getStateDelta());
+    }
+}
+
+
+
+void Engine::unloadCity()
+{
+    if (!simulation) {
+        return;
+    }
+
+    stateClock.stop();
+
+    // The processor clock must be stopped by the thread that started it.
+    simulation->sendCommandAndWait([](CitySimulation& simulation) {
+        simulation.getCity().getProcessor().pause();
+    });
+    simulationThread.quit();
+    simulationThread.wait();
 
-    city->createBuilding(type, leftCorner, orientation);
+    delete simulation;
+    simulation = nullptr;
 }
@@ -1,44 +1,89 @@
 #ifndef ENGINE_HPP
 #define ENGINE_HPP
 
+#include <QtCore/QBasicTimer>
+#include <QtCore/QList>
 #include <QtCore/QObject>
 #include <QtCore/QString>
+#include <QtCore/QThread>
 
+#include "src/global/geometry/TileArea.hpp"
+#include "src/global/geometry/TileCoordinates.hpp"
 #include "src/global/state/CityState.hpp"
 #include "src/global/state/State.hpp"
+#include "src/global/state/StateDelta.hpp"
 #include "src/viewer/construction/AreaCheckerInterface.hpp"
 #include "src/viewer/construction/RoadPathGeneratorInterface.hpp"
 #include "src/defines.hpp"
 
 class BuildingInformation;
-class City;
+class CitySimulation;
 class Conf;
 class QSize;
-class TileArea;
 struct MapState;
 
+/**
+ * @brief The entry point of the GUI to the engine.
+ *
+ * The city is simulated on a dedicated thread (see CitySimulation), so that long cycles never freeze the GUI. The
+ * engine lives on the GUI thread: its slots are turned into commands for the simulation thread, and it polls the state
+ * deltas published by the simulation to emit them on the GUI thread.
+ */
 class Engine : public QObject, public AreaCheckerInterface, public RoadPathGeneratorInterface
 {
         Q_OBJECT
 
     private:
         const Conf& conf;
-        optional<owner<City*>> city;
+        QThread simulationThread;
+        optional<owner<CitySimulation*>> simulation;
+        QBasicTimer stateClock;
+        qreal speedRatio; ///< The speed ratio requested last, kept to be read without querying the simulation.
 
     public:
         Engine(const Conf& conf);
         ~Engine();
 
+        /**
+         * @brief Load a city file or a saved city.
+         *
+         * The current city is only replaced once the new one is loaded: it is kept if the file cannot be loaded.
+         *
+         * @throw Exception The file cannot be loaded.
+         */
         void loadCity(const QString& cityFilePath);
 
+        /**
+         * @brief Save the full state of the current city into a snapshot file, loadable with loadCity().
+         *
+         * The state is captured by the simulation thread between two cycles, then written on the calling thread.
+         *
+         * @throw UnexpectedException The file cannot be written.
+         */
+        void saveCity(const QString& filePath) const;
+
         MapState getMapState() const;
-        State getCurrentState() const;
 
-        virtual bool isConstructible(const TileArea& area) const override;
-        virtual QList<TileCoordinates> getShortestPathForRoad(
-            const TileCoordinates& origin,
-            const TileCoordinates& target
-        ) const override;
+        /**
+         * @brief Get the state of the city when it was loaded.
+         *
+         * The state is then only updated through the deltas emitted by stateUpdated().
+         */
+        const State& getInitialState() const;
+
+        /**
+         * @brief Request to check if the area is constructible.
+         *
+         * The query does not wait for the simulation thread: the answer is emitted by constructibilityChecked().
+         */
+        virtual void requestConstructibilityCheck(const TileArea& area) override;
+
+        /**
+         * @brief Request the shortest path for a road between the two given locations.
+         *
+         * The query does not wait for the simulation thread: the answer is emitted by shortestPathForRoadGenerated().
+         */
+        virtual void requestShortestPathForRoad(const TileCoordinates& origin, const TileCoordinates& target) override;
 
     public slots:
         /**
@@ -73,10 +118,48 @@ class Engine : public QObject, public AreaCheckerInterface, public RoadPathGener
          */
         void createBuilding(const BuildingInformation& type, const TileCoordinates& leftCorner, Direction orientation);
 
+        /**
+         * @brief Indicate the consumer has applied the state up to the given version.
+         *
+         * Until then, each update contains all the changes since the previously acknowledged version.
+         */
+        void acknowledgeState(const int version);
+
+        /**
+         * @brief Make the next update a full resync, listing all the elements of the city.
+         */
+        void requestFullResync();
+
+    protected:
+        /**
+         * @brief Emit the latest state delta published by the simulation, if any.
+         */
+        virtual void timerEvent(QTimerEvent* event) override;
+
     signals:
-        void stateUpdated(State);
+        /**
+         * @brief Emitted with the changes since the last acknowledged version of the state.
+         *
+         * When several cycles are processed between two updates, only the latest delta is emitted. Since it contains all
+         * the changes since the last acknowledged version, no change is lost.
+         */
+        void stateUpdated(StateDelta delta);
+
+        /**
+         * @brief Emitted with the answer to requestConstructibilityCheck().
+         */
+        void constructibilityChecked(TileArea area, bool isConstructible);
 
+        /**
+         * @brief Emitted with the answer to requestShortestPathForRoad().
+         */
+        void shortestPathForRoadGenerated(TileCoordinates origin, TileCoordinates target, QList<TileCoordinates> path);
 
+    private:
+        /**
+         * @brief Stop the simulation thread and destroy the current city, if any.
+         */
+        void unloadCity();
 };
 
 #endif // ENGINE_HPP
@@ -0,0 +1,189 @@
+#include "StateJournal.hpp"
+
+#include "src/engine/map/dynamicElement/character/Character.hpp"
+#include "src/engine/map/staticElement/building/AbstractBuilding.hpp"
+#include "src/engine/map/staticElement/natureElement/NatureElement.hpp"
+
+/**
+ * The maximum quantity of versions kept for a consumer that does not acknowledge them. Beyond that, the consumer gets a
+ * full resync.
+ */
+const int MAX_UNACKNOWLEDGED_VERSIONS(300);
+
+
+
+StateJournal::StateJournal() :
+    version(0),
+    oldestVersion(0),
+    buildings(),
+    natureElements(),
+    characters()
+{
+
+}
+
+
+
+int StateJournal::getVersion() const
+{
+    return version;
+}
+
+
+
+void StateJournal::registerBuilding(const AbstractBuilding& building)
+{
+    buildings.create(building, building.getId(), version + 1);
+}
+
+
+
+void StateJournal::notifyBuildingChange(const AbstractBuilding& building)
+{
+    buildings.change(building.getId(), version + 1);
+}
+
+
+
+void StateJournal::registerNatureElement(const NatureElement& natureElement)
+{
+    // Nature elements do not change for now.
+    natureElements.create(natureElement, natureElement.getId(), version + 1);
+}
+
+
+
+void StateJournal::registerCharacter(const Character& character)
+{
+    // The handle, not the address: a new character may reuse the pooled memory of one destroyed during the same cycle.
+    characters.create(character, character.getHandle().pack(), version + 1);
+}
+
+
+
+void StateJournal::notifyCharacterChange(const Character& character)
+{
+    characters.change(character.getHandle().pack(), version + 1);
+}
+
+
+
+void StateJournal::unregisterCharacter(const Character& character)
+{
+    characters.destroy(character.getHandle().pack(), version + 1);
+}
+
+
+
+void StateJournal::publish()
+{
+    ++version;
+    if (version - oldestVersion > MAX_UNACKNOWLEDGED_VERSIONS) {
+        acknowledge(version - MAX_UNACKNOWLEDGED_VERSIONS);
+    }
+}
+
+
+
+void StateJournal::acknowledge(const int version)
+{
+    if (version <= oldestVersion || version > this->version) {
+        return;
+    }
+
+    oldestVersion = version;
+    buildings.prune(version);
+    natureElements.prune(version);
+    characters.prune(version);
+}
+
+
+
+StateDelta StateJournal::getDelta(const int sinceVersion, const CityState& cityState) const
+{
+    bool isFullResync(sinceVersion < oldestVersion || sinceVersion > version);
+    StateDelta delta(version, isFullResync, cityState);
+
+    if (isFullResync) {
+        for (auto& entry : natureElements.entries) {
+            delta.createdNatureElements.append(entry.element->getState());
+        }
+        for (auto& entry : buildings.entries) {
+            delta.createdBuildings.append(entry.element->getCurrentState());
+        }
+        for (auto& entry : characters.entries) {
+            delta.createdCharacters.append(entry.element->getCurrentState());
+        }
+
+        return delta;
+    }
+
+    // An element changed several times is only listed for its last change, and not at all once destroyed.
+    for (auto& change : natureElements.changes) {
+        auto entry(natureElements.entries.constFind(change.second));
+        if (change.first > sinceVersion && entry != natureElements.entries.constEnd()) {
+            delta.createdNatureElements.append(entry->element->getState());
+        }
+    }
+    for (auto& change : buildings.changes) {
+        auto entry(buildings.entries.constFind(change.second));
+        if (
+            change.first <= sinceVersion ||
+            entry == buildings.entries.constEnd() ||
+            entry->changeVersion != change.first
+        ) {
+            continue;
+        }
+        if (entry->creationVersion > sinceVersion) {
+            delta.createdBuildings.append(entry->element->getCurrentState());
+        }
+        else {
+            delta.changedBuildings.append(entry->element->getCurrentState());
+        }
+    }
+    for (auto& change : characters.changes) {
+        auto entry(characters.entries.constFind(change.second));
+        if (
+            change.first <= sinceVersion ||
+            entry == characters.entries.constEnd() ||
+            entry->changeVersion != change.first
+        ) {
+            continue;
+        }
+        if (entry->creationVersion > sinceVersion) {
+            delta.createdCharacters.append(entry->element->getCurrentState());
+        }
+        else {
+            delta.changedCharacters.append(entry->element->getCurrentState());
+        }
+    }
+
+    for (auto& destroyed : natureElements.destroyed) {
+        if (destroyed.first > sinceVersion) {
+            delta.destroyedNatureElements.append(destroyed.second);
+        }
+    }
+    for (auto& destroyed : buildings.destroyed) {
+        if (destroyed.first > sinceVersion) {
+            delta.destroyedBuildings.append(destroyed.second);
+        }
+    }
+    for (auto& destroyed : characters.destroyed) {
+        if (destroyed.first > sinceVersion) {
+            delta.destroyedCharacters.append(destroyed.second);
+        }
+    }
+
+    return delta;
+}
+
+
+
+void StateJournal::clear()
+{
+    version = 0;
+    oldestVersion = 0;
+    buildings.clear();
+    natureElements.clear();
+    characters.clear();
+}
@@ -0,0 +1,139 @@
+#ifndef STATEJOURNAL_HPP
+#define STATEJOURNAL_HPP
+
+#include <QtCore/QHash>
+#include <QtCore/QList>
+#include <QtCore/QPair>
+
+#include "src/global/state/StateDelta.hpp"
+
+class AbstractBuilding;
+class Character;
+class NatureElement;
+
+/**
+ * @brief A journal of the elements changes, version after version.
+ *
+ * The elements report their own creation, changes and destruction to the journal as they happen (see
+ * City::attachStateJournal()). These are recorded by ID for the next version, which is published after each cycle. So
+ * a cycle costs a time proportional to the number of changes, whatever the number of elements in the city. No state is
+ * built while recording. A delta can then be generated since any version still covered by the journal: only the
+ * elements created or changed since this version get their state built, and the destroyed ones are listed by ID.
+ *
+ * The journal keeps track of the changes and the destroyed elements until the consumer acknowledges a newer version. A
+ * delta requested since an older (or unknown) version is a full resync. A consumer lagging too many versions behind
+ * gets a full resync too, so that the journal never grows unbounded.
+ */
+class StateJournal
+{
+    private:
+        template<class Element>
+        struct Entry {
+            const Element* element;
+            int creationVersion;
+            int changeVersion;
+        };
+
+        template<class Element>
+        struct Track {
+            QHash<quint64, Entry<Element>> entries;
+            QList<QPair<int, quint64>> changes; ///< The created or changed elements IDs, once per version of the change.
+            QList<QPair<int, quint64>> destroyed; ///< The destroyed elements IDs, with the version of their destruction.
+
+            void create(const Element& element, const quint64 id, const int version)
+            {
+                entries.insert(id, { &element, version, version });
+                changes.append({ version, id });
+            }
+
+            void change(const quint64 id, const int version)
+            {
+                auto entry(entries.find(id));
+                if (entry == entries.end() || entry->changeVersion == version) {
+                    return;
+                }
+
+                entry->changeVersion = version;
+                changes.append({ version, id });
+            }
+
+            void destroy(const quint64 id, const int version)
+            {
+                auto entry(entries.find(id));
+                if (entry == entries.end()) {
+                    return;
+                }
+
+                // An element created in the same version was never published.
+                if (entry->creationVersion != version) {
+                    destroyed.append({ version, id });
+                }
+                entries.erase(entry);
+            }
+
+            void prune(const int version)
+            {
+                while (!changes.isEmpty() && changes.first().first <= version) {
+                    changes.removeFirst();
+                }
+                while (!destroyed.isEmpty() && destroyed.first().first <= version) {
+                    destroyed.removeFirst();
+                }
+            }
+
+            void clear()
+            {
+                entries.clear();
+                changes.clear();
+                destroyed.clear();
+            }
+        };
+
+    private:
+        int version; ///< The last published version. The changes are recorded for the next one.
+        int oldestVersion; ///< The oldest version a delta can be generated since.
+        Track<AbstractBuilding> buildings;
+        Track<NatureElement> natureElements;
+        Track<Character> characters;
+
+    public:
+        StateJournal();
+
+        int getVersion() const;
+
+        // Element changes, recorded for the next version.
+        void registerBuilding(const AbstractBuilding& building);
+        void notifyBuildingChange(const AbstractBuilding& building);
+        void registerNatureElement(const NatureElement& natureElement);
+        void registerCharacter(const Character& character);
+        void notifyCharacterChange(const Character& character);
+        void unregisterCharacter(const Character& character);
+
+        /**
+         * @brief Publish the changes recorded since the last version as a new version.
+         */
+        void publish();
+
+        /**
+         * @brief Indicate the consumer has applied the state up to the given version.
+         *
+         * The changes and destroyed elements up to this version are forgotten: a delta can no longer be generated
+         * since an older version.
+         */
+        void acknowledge(const int version);
+
+        /**
+         * @brief Generate the delta since the given version, or a full resync if this version is not covered anymore.
+         *
+         * @param sinceVersion The version to start from. A negative version always forces a full resync.
+         * @param cityState    The current state of the city.
+         */
+        StateDelta getDelta(const int sinceVersion, const CityState& cityState) const;
+
+        /**
+         * @brief Forget about all the elements, for instance when loading another city.
+         */
+        void clear();
+};
+
+#endif // STATEJOURNAL_HPP
@@ -1,6 +1,7 @@
 #include "City.hpp"
 
 #include "src/engine/loader/CityLoader.hpp"
+#include "src/engine/loader/CitySnapshot.hpp"
 #include "src/global/conf/BuildingInformation.hpp"
 #include "src/global/conf/Conf.hpp"
 
@@ -41,6 +42,29 @@ City::City(const Conf& conf, CityLoader& loader) :
 
 
 
+City::City(const Conf& conf, const CitySnapshot& snapshot) :
+    TITLE(snapshot.title),
+    processor(CycleDate(snapshot.year, snapshot.month, snapshot.cycles)),
+    population(),
+    map(conf, snapshot, population, population),
+    budget(snapshot.budget)
+{
+    // The working places have been registered again while restoring the map.
+    population.restore(snapshot);
+
+    processor.registerProcessable(map);
+    processor.registerProcessable(population);
+}
+
+
+
+const QString& City::getTitle() const
+{
+    return TITLE;
+}
+
+
+
 TimeCycleProcessor& City::getProcessor()
 {
     return processor;
@@ -107,3 +131,24 @@ QList<CharacterState> City::getCharactersState() const
 {
     return map.getCharactersState();
 }
+
+
+
+void City::attachStateJournal(StateJournal& journal)
+{
+    map.attachStateJournal(journal);
+}
+
+
+
+void City::save(CitySnapshot& snapshot) const
+{
+    auto& date(processor.getCurrentDate());
+    snapshot.title = TITLE;
+    snapshot.year = date.getYear();
+    snapshot.month = date.getMonth();
+    snapshot.cycles = date.getCycles();
+    snapshot.budget = budget;
+    population.save(snapshot);
+    map.save(snapshot);
+}
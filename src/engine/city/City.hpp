@@ -10,12 +10,22 @@
 
 class CityLoader;
 class Conf;
+struct CitySnapshot;
+class StateJournal;
 
 class City
 {
     public:
         City(const Conf& conf, CityLoader& loader);
 
+        /**
+         * @brief Restore a saved city, in the state it had between two cycles.
+         *
+         * @throw UnexpectedException The snapshot does not match the configuration.
+         */
+        City(const Conf& conf, const CitySnapshot& snapshot);
+
+        const QString& getTitle() const;
         TimeCycleProcessor& getProcessor();
         void createBuilding(const BuildingInformation& conf, const TileCoordinates& leftCorner, Direction orientation);
 
@@ -28,6 +38,20 @@ class City
         QList<NatureElementState> getNatureElementsState() const;
         QList<CharacterState> getCharactersState() const;
 
+        /**
+         * @brief Let all the elements of the city, present and future, report their changes to the journal.
+         *
+         * The journal must outlive the city.
+         */
+        void attachStateJournal(StateJournal& journal);
+
+        /**
+         * @brief Save the full state of the city, to be restored later.
+         *
+         * Must be called between two cycles.
+         */
+        void save(CitySnapshot& snapshot) const;
+
     private:
         const QString TITLE;
         TimeCycleProcessor processor;
@@ -1,15 +1,19 @@
 #include "PopulationHandler.hpp"
 
+#include <algorithm>
+
+#include "src/engine/loader/CitySnapshot.hpp"
 #include "src/engine/map/staticElement/building/AbstractProcessableBuilding.hpp"
+#include "src/exceptions/UnexpectedException.hpp"
 #include "src/global/conf/BuildingInformation.hpp"
 
 
 
 PopulationHandler::PopulationHandler() :
-    previousPopulation(0),
     population(0),
-    workingPlacesHasChanged(false),
-    workingPlaces()
+    workingPlaces(),
+    frontier(0),
+    distributedWorkers(0)
 {
 
 }
@@ -39,39 +43,147 @@ void PopulationHandler::unregisterPopulation(int quantity)
 
 void PopulationHandler::registerWorkingPlace(const QSharedPointer<AbstractProcessableBuilding>& building)
 {
-    workingPlaces.insert(building.get(), building);
-    workingPlacesHasChanged = true;
+    auto priority(building->getConf().getWorkerPriority());
+
+    // Insert after all the working places of higher or same priority, in order to keep the registration order. The
+    // working places are sorted by decreasing priority, so the position is found by binary search.
+    auto position(std::upper_bound(
+        workingPlaces.begin(),
+        workingPlaces.end(),
+        priority,
+        [](const int priority, const WorkingPlace& workingPlace) {
+            return workingPlace.priority < priority;
+        }
+    ));
+    auto index(static_cast<int>(position - workingPlaces.begin()));
+    workingPlaces.insert(index, { building, priority, building->getConf().getMaxWorkers(), 0 });
+
+    // The new working place gets its workers before all the following ones.
+    if (index <= frontier) {
+        clearWorkersFrom(index);
+    }
 }
 
 
 
 void PopulationHandler::unregisterWorkingPlace(const QSharedPointer<AbstractProcessableBuilding>& building)
 {
-    workingPlaces.remove(building.get());
-    workingPlacesHasChanged = true;
+    for (int index(0); index < workingPlaces.size(); ++index) {
+        if (workingPlaces.at(index).building == building) {
+            assignWorkers(workingPlaces[index], 0);
+            workingPlaces.remove(index);
+            if (index < frontier) {
+                --frontier;
+            }
+
+            return;
+        }
+    }
 }
 
 
 
 void PopulationHandler::process(const CycleDate& /*date*/)
 {
-    if (population != previousPopulation || workingPlacesHasChanged) {
-        updateWorkerDistribution();
+    auto workforce(getWorkforce());
+    if (workforce > distributedWorkers) {
+        addWorkers(workforce - distributedWorkers);
+    }
+    else if (workforce < distributedWorkers) {
+        removeWorkers(distributedWorkers - workforce);
+    }
+}
+
+
 
-        previousPopulation = population;
-        workingPlacesHasChanged = false;
+void PopulationHandler::save(CitySnapshot& snapshot) const
+{
+    snapshot.population = population;
+    snapshot.workerFrontier = frontier;
+    snapshot.workers.resize(workingPlaces.size());
+    for (int i(0); i < workingPlaces.size(); ++i) {
+        snapshot.workers[i] = workingPlaces.at(i).workers;
     }
 }
 
 
 
-void PopulationHandler::updateWorkerDistribution()
+void PopulationHandler::restore(const CitySnapshot& snapshot)
 {
-    // For now, a dummy algorithm that fill up working place randomly.
-    int remainingWorkers(population / 2);
-    for (auto& workingPlace : workingPlaces) {
-        int workPlaceWorkers(qMin(remainingWorkers, workingPlace->getConf().getMaxWorkers()));
-        workingPlace->assignWorkers(workPlaceWorkers);
-        remainingWorkers -= workPlaceWorkers;
+    if (
+        snapshot.workers.size() != workingPlaces.size() ||
+        snapshot.workerFrontier < 0 ||
+        snapshot.workerFrontier > workingPlaces.size()
+    ) {
+        throw UnexpectedException("The working places do not match the city snapshot.");
+    }
+
+    population = snapshot.population;
+    for (int i(0); i < workingPlaces.size(); ++i) {
+        auto& workingPlace(workingPlaces[i]);
+        assignWorkers(workingPlace, qBound(0, snapshot.workers.at(i), workingPlace.maxWorkers));
     }
+    frontier = snapshot.workerFrontier;
+}
+
+
+
+int PopulationHandler::getWorkforce() const
+{
+    return population / 2;
+}
+
+
+
+void PopulationHandler::addWorkers(int quantity)
+{
+    while (quantity > 0 && frontier < workingPlaces.size()) {
+        auto& workingPlace(workingPlaces[frontier]);
+        int addedWorkers(qMin(quantity, workingPlace.maxWorkers - workingPlace.workers));
+        assignWorkers(workingPlace, workingPlace.workers + addedWorkers);
+        quantity -= addedWorkers;
+        if (workingPlace.workers == workingPlace.maxWorkers) {
+            ++frontier;
+        }
+    }
+}
+
+
+
+void PopulationHandler::removeWorkers(int quantity)
+{
+    while (quantity > 0 && distributedWorkers > 0) {
+        if (frontier == workingPlaces.size() || workingPlaces.at(frontier).workers == 0) {
+            // The working place before the frontier is full, it becomes the new frontier.
+            --frontier;
+            continue;
+        }
+
+        auto& workingPlace(workingPlaces[frontier]);
+        int removedWorkers(qMin(quantity, workingPlace.workers));
+        assignWorkers(workingPlace, workingPlace.workers - removedWorkers);
+        quantity -= removedWorkers;
+    }
+}
+
+
+
+void PopulationHandler::clearWorkersFrom(const int index)
+{
+    // Only the working places up to the frontier have workers, the frontier may have moved by one after an insertion.
+    for (int i(index); i < workingPlaces.size() && i <= frontier + 1; ++i) {
+        if (workingPlaces.at(i).workers > 0) {
+            assignWorkers(workingPlaces[i], 0);
+        }
+    }
+    frontier = index;
+}
+
+
+
+void PopulationHandler::assignWorkers(WorkingPlace& workingPlace, const int workers)
+{
+    distributedWorkers += workers - workingPlace.workers;
+    workingPlace.workers = workers;
+    workingPlace.building->assignWorkers(workers);
 }
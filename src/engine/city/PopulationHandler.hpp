@@ -1,25 +1,42 @@
 #ifndef POPULATIONHANDLER_HPP
 #define POPULATIONHANDLER_HPP
 
-#include <QtCore/QHash>
 #include <QtCore/QSharedPointer>
+#include <QtCore/QVector>
 
 #include "src/engine/city/PopulationRegistryInterface.hpp"
 #include "src/engine/city/WorkingPlaceRegistryInterface.hpp"
 #include "src/engine/processing/AbstractProcessable.hpp"
 
 class AbstractProcessableBuilding;
+struct CitySnapshot;
 
 /**
  * @brief Handles the population and the worker distribution.
+ *
+ * Half of the population works. The workers fill up the working places one after the other, ordered by decreasing
+ * worker priority (see BuildingInformation) and then by registration order. So, at any time, the working places are
+ * full up to the frontier, the working place at the frontier may be partially filled and all the following ones are
+ * empty.
+ *
+ * The distribution is incremental: when the workforce changes, only the working places around the frontier are updated.
+ * The result is the same than filling up all the working places from scratch.
  */
 class PopulationHandler : public AbstractProcessable, public PopulationRegistryInterface, public WorkingPlaceRegistryInterface
 {
     private:
-        int previousPopulation;
+        struct WorkingPlace {
+            QSharedPointer<AbstractProcessableBuilding> building;
+            int priority;
+            int maxWorkers;
+            int workers;
+        };
+
+    private:
         int population;
-        bool workingPlacesHasChanged;
-        QHash<AbstractProcessableBuilding*, QSharedPointer<AbstractProcessableBuilding>> workingPlaces;
+        QVector<WorkingPlace> workingPlaces;
+        int frontier;///< The index of the first working place that may not be full.
+        int distributedWorkers;
 
     public:
         PopulationHandler();
@@ -34,8 +51,36 @@ class PopulationHandler : public AbstractProcessable, public PopulationRegistryI
 
         virtual void process(const CycleDate& date) override;
 
+        void save(CitySnapshot& snapshot) const;
+
+        /**
+         * @brief Restore the population and the workers of each working place.
+         *
+         * The working places must have been registered again, in the same order as when the population was saved.
+         *
+         * @throw UnexpectedException The working places do not match the snapshot.
+         */
+        void restore(const CitySnapshot& snapshot);
+
     private:
-        void updateWorkerDistribution();
+        int getWorkforce() const;
+
+        /**
+         * @brief Fill up the working places from the frontier.
+         */
+        void addWorkers(int quantity);
+
+        /**
+         * @brief Free workers from the frontier, going backward.
+         */
+        void removeWorkers(int quantity);
+
+        /**
+         * @brief Empty all the working places from the given index, which becomes the frontier.
+         */
+        void clearWorkersFrom(const int index);
+
+        void assignWorkers(WorkingPlace& workingPlace, const int workers);
 };
 
 #endif // POPULATIONHANDLER_HPP
@@ -0,0 +1,297 @@
+#include "CitySnapshot.hpp"
+
+#include <QtCore/QDataStream>
+#include <QtCore/QFile>
+#include <QtCore/QSaveFile>
+#include <QtCore/QSysInfo>
+
+#include "src/exceptions/FileNotFoundException.hpp"
+#include "src/exceptions/UnexpectedException.hpp"
+
+const quint32 SNAPSHOT_MAGIC_NUMBER(0x43425356);
+const quint32 SNAPSHOT_VERSION(1);
+const int HEADER_SIZE(10);///< The magic number, the version, the byte order and the compression flag.
+
+const qint32 CitySnapshot::NO_PATH(-1);
+
+static_assert(sizeof(CitySnapshot::Location) == 8, "The records are written as raw memory.");
+static_assert(sizeof(CitySnapshot::NatureElement) == 24, "The records are written as raw memory.");
+static_assert(sizeof(CitySnapshot::Building) == 56, "The records are written as raw memory.");
+static_assert(sizeof(CitySnapshot::Character) == 120, "The records are written as raw memory.");
+
+
+
+static bool isRangeValid(const qint32 first, const qint32 count, const int size)
+{
+    return first >= 0 && count >= 0 && first <= size - count;
+}
+
+
+
+static bool isKeyValid(const qint32 key, const QStringList& keys)
+{
+    return key >= 0 && key < keys.size();
+}
+
+
+
+/**
+ * @brief Check that the records only reference existing keys, values and path tiles.
+ *
+ * The references between the arrays are checked once, so that restoring the city can rely on them.
+ */
+static bool isConsistent(const CitySnapshot& snapshot)
+{
+    for (auto& natureElement : snapshot.natureElements) {
+        if (!isKeyValid(natureElement.conf, snapshot.natureElementKeys)) {
+            return false;
+        }
+    }
+    auto& civilianEntryPoint(snapshot.civilianEntryPoint);
+    if (!isRangeValid(civilianEntryPoint.firstValue, civilianEntryPoint.valueCount, snapshot.values.size())) {
+        return false;
+    }
+    for (auto& building : snapshot.buildings) {
+        if (
+            !isKeyValid(building.conf, snapshot.buildingKeys) ||
+            !isRangeValid(building.firstValue, building.valueCount, snapshot.values.size())
+        ) {
+            return false;
+        }
+    }
+    for (auto releasedSlot : snapshot.releasedCharacterSlots) {
+        if (releasedSlot >= static_cast<quint32>(snapshot.characterSlots.size())) {
+            return false;
+        }
+    }
+    bool waitingForRegistration(false);
+    for (auto& character : snapshot.characters) {
+        if (
+            !isKeyValid(character.conf, snapshot.characterKeys) ||
+            !isRangeValid(character.path.firstTile, character.path.tileCount, snapshot.pathTiles.size())
+        ) {
+            return false;
+        }
+        // The characters waiting for registration are the last ones of the processing order.
+        if (waitingForRegistration && !(character.flags & CitySnapshot::Character::WaitingForRegistration)) {
+            return false;
+        }
+        waitingForRegistration = character.flags & CitySnapshot::Character::WaitingForRegistration;
+    }
+
+    return true;
+}
+
+
+
+template<class T>
+static void writeArray(QDataStream& stream, const QVector<T>& array)
+{
+    stream << qint32(array.size());
+    stream.writeRawData(reinterpret_cast<const char*>(array.constData()), array.size() * sizeof(T));
+}
+
+
+
+template<class T>
+static void readArray(QDataStream& stream, QVector<T>& array)
+{
+    qint32 size;
+    stream >> size;
+    if (stream.status() != QDataStream::Ok) {
+        return;
+    }
+    if (size < 0 || static_cast<quint64>(size) * sizeof(T) > static_cast<quint64>(stream.device()->bytesAvailable())) {
+        stream.setStatus(QDataStream::ReadCorruptData);
+        return;
+    }
+
+    array.resize(size);
+    int byteCount(size * sizeof(T));
+    if (stream.readRawData(reinterpret_cast<char*>(array.data()), byteCount) != byteCount) {
+        stream.setStatus(QDataStream::ReadPastEnd);
+    }
+}
+
+
+
+template<class T>
+static void writeRecord(QDataStream& stream, const T& record)
+{
+    stream.writeRawData(reinterpret_cast<const char*>(&record), sizeof(T));
+}
+
+
+
+template<class T>
+static void readRecord(QDataStream& stream, T& record)
+{
+    if (stream.readRawData(reinterpret_cast<char*>(&record), sizeof(T)) != sizeof(T)) {
+        stream.setStatus(QDataStream::ReadPastEnd);
+    }
+}
+
+
+
+CitySnapshot::CitySnapshot() :
+    title(),
+    year(0),
+    month(0),
+    cycles(0),
+    budget(0),
+    population(0),
+    workerFrontier(0),
+    workers(),
+    mapSize(),
+    mapEntryPoint({ 0, 0 }),
+    randomGeneratorState(),
+    buildingKeys(),
+    characterKeys(),
+    itemKeys(),
+    natureElementKeys(),
+    natureElements(),
+    civilianEntryPoint(),
+    buildings(),
+    characterSlots(),
+    releasedCharacterSlots(),
+    characters(),
+    pathTiles(),
+    values()
+{
+
+}
+
+
+
+qint32 CitySnapshot::indexKey(QStringList& keys, const QString& key)
+{
+    auto index(keys.indexOf(key));
+    if (index < 0) {
+        index = keys.size();
+        keys.append(key);
+    }
+
+    return index;
+}
+
+
+
+bool CitySnapshot::isSnapshot(const QString& filePath)
+{
+    QFile file(filePath);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+
+    QDataStream stream(&file);
+    quint32 magicNumber;
+    stream >> magicNumber;
+
+    return stream.status() == QDataStream::Ok && magicNumber == SNAPSHOT_MAGIC_NUMBER;
+}
+
+
+
+CitySnapshot CitySnapshot::load(const QString& filePath)
+{
+    QFile file(filePath);
+    if (!file.open(QIODevice::ReadOnly)) {
+        throw FileNotFoundException(filePath);
+    }
+
+    // The mapping is only a way to avoid copying the file: read it the usual way if the file cannot be mapped.
+    QByteArray content;
+    auto size(file.size());
+    auto mapping(size > 0 ? file.map(0, size) : nullptr);
+    if (mapping) {
+        content = QByteArray::fromRawData(reinterpret_cast<const char*>(mapping), size);
+    }
+    else {
+        content = file.readAll();
+    }
+
+    QDataStream headerStream(content);
+    headerStream.setVersion(QDataStream::Qt_5_15);
+    quint32 magicNumber;
+    quint32 version;
+    quint8 byteOrder;
+    quint8 isCompressed;
+    headerStream >> magicNumber >> version >> byteOrder >> isCompressed;
+    if (headerStream.status() != QDataStream::Ok || magicNumber != SNAPSHOT_MAGIC_NUMBER) {
+        throw UnexpectedException("The file \"" + filePath + "\" is not a city snapshot.");
+    }
+    if (version != SNAPSHOT_VERSION) {
+        throw UnexpectedException(
+            "The city snapshot \"" + filePath + "\" has version " + QString::number(version) + ", only version " +
+            QString::number(SNAPSHOT_VERSION) + " is supported."
+        );
+    }
+    if (byteOrder != QSysInfo::ByteOrder) {
+        throw UnexpectedException("The city snapshot \"" + filePath + "\" has been saved with another byte order.");
+    }
+
+    auto payload(QByteArray::fromRawData(content.constData() + HEADER_SIZE, content.size() - HEADER_SIZE));
+    if (isCompressed) {
+        payload = qUncompress(payload);
+        if (payload.isEmpty()) {
+            throw UnexpectedException("The city snapshot \"" + filePath + "\" is corrupted.");
+        }
+    }
+
+    CitySnapshot snapshot;
+    QDataStream stream(payload);
+    stream.setVersion(QDataStream::Qt_5_15);
+    stream >> snapshot.title >> snapshot.year >> snapshot.month >> snapshot.cycles >> snapshot.budget
+        >> snapshot.population >> snapshot.workerFrontier;
+    readArray(stream, snapshot.workers);
+    stream >> snapshot.mapSize >> snapshot.mapEntryPoint.x >> snapshot.mapEntryPoint.y
+        >> snapshot.randomGeneratorState;
+    stream >> snapshot.buildingKeys >> snapshot.characterKeys >> snapshot.itemKeys >> snapshot.natureElementKeys;
+    readArray(stream, snapshot.natureElements);
+    readRecord(stream, snapshot.civilianEntryPoint);
+    readArray(stream, snapshot.buildings);
+    readArray(stream, snapshot.characterSlots);
+    readArray(stream, snapshot.releasedCharacterSlots);
+    readArray(stream, snapshot.characters);
+    readArray(stream, snapshot.pathTiles);
+    readArray(stream, snapshot.values);
+    if (stream.status() != QDataStream::Ok || !stream.atEnd() || !isConsistent(snapshot)) {
+        throw UnexpectedException("The city snapshot \"" + filePath + "\" is corrupted.");
+    }
+
+    return snapshot;
+}
+
+
+
+void CitySnapshot::save(const QString& filePath, const bool compress) const
+{
+    QByteArray payload;
+    QDataStream stream(&payload, QIODevice::WriteOnly);
+    stream.setVersion(QDataStream::Qt_5_15);
+    stream << title << year << month << cycles << budget << population << workerFrontier;
+    writeArray(stream, workers);
+    stream << mapSize << mapEntryPoint.x << mapEntryPoint.y << randomGeneratorState;
+    stream << buildingKeys << characterKeys << itemKeys << natureElementKeys;
+    writeArray(stream, natureElements);
+    writeRecord(stream, civilianEntryPoint);
+    writeArray(stream, buildings);
+    writeArray(stream, characterSlots);
+    writeArray(stream, releasedCharacterSlots);
+    writeArray(stream, characters);
+    writeArray(stream, pathTiles);
+    writeArray(stream, values);
+
+    QSaveFile file(filePath);
+    if (!file.open(QIODevice::WriteOnly)) {
+        throw UnexpectedException("Unable to open the file \"" + filePath + "\" to save the city.");
+    }
+
+    QDataStream headerStream(&file);
+    headerStream.setVersion(QDataStream::Qt_5_15);
+    headerStream << SNAPSHOT_MAGIC_NUMBER << SNAPSHOT_VERSION << quint8(QSysInfo::ByteOrder) << quint8(compress);
+    file.write(compress ? qCompress(payload) : payload);
+    if (!file.commit()) {
+        throw UnexpectedException("Unable to write the city snapshot \"" + filePath + "\".");
+    }
+}
@@ -0,0 +1,163 @@
+#ifndef CITYSNAPSHOT_HPP
+#define CITYSNAPSHOT_HPP
+
+#include <QtCore/QByteArray>
+#include <QtCore/QSize>
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+#include <QtCore/QVector>
+
+/**
+ * @brief The full state of a city between two cycles, saved to or loaded from a binary file.
+ *
+ * Contrary to a city file read by CityLoader, which only describes the initial map, a snapshot holds everything needed
+ * to resume the simulation where it stopped: the count downs and stocks of the buildings, the characters with their
+ * paths and motion, the worker distribution, the date and the state of the random generator of the map.
+ *
+ * The elements are kept as arrays of fixed-size records, in the order of their registries. The configurations are
+ * referenced by their index in the key tables of the snapshot and the handles are packed into 64-bit integers (see
+ * Handle::pack()). The variable-length parts (path tiles, stocks, miners...) are ranges of the shared `pathTiles` and
+ * `values` arrays. So each array is written and read in bulk, without encoding the elements one by one.
+ *
+ * The file starts with a small header (magic number, format version, byte order and compression), followed by the
+ * payload, optionally compressed with qCompress(). The records are written in the byte order of the host that saved
+ * them: a file saved on a host of the other byte order is rejected. The file is read through a memory mapping, so an
+ * uncompressed payload is never copied before being split into the arrays.
+ */
+struct CitySnapshot
+{
+    static const qint32 NO_PATH;///< The path type of the characters without any path.
+
+    struct Location {
+        qint32 x;
+        qint32 y;
+    };
+
+    struct NatureElement {
+        enum Flag : quint32 {
+            Busy = 0x1,
+        };
+
+        qint32 conf;///< The index of the key in `natureElementKeys`.
+        Location leftCorner;
+        qint32 width;
+        qint32 height;
+        quint32 flags;
+    };
+
+    /**
+     * @brief A building and the state of its kind.
+     *
+     * The count downs, the quantity and the values are interpreted by each kind of building (see AbstractBuilding).
+     */
+    struct Building {
+        enum Flag : quint32 {
+            HasRequestedInhabitants = 0x1,
+        };
+
+        quint64 character;///< The packed handle of the character the building waits for (delivery man, walker...).
+        qint32 conf;///< The index of the key in `buildingKeys`.
+        qint32 orientation;
+        Location leftCorner;
+        Location entryPoint;///< Only for the processable buildings.
+        qint32 countDown;
+        qint32 generationCountDown;///< The count down of the walker generation.
+        qint32 quantity;
+        quint32 flags;
+        qint32 firstValue;///< The first value of the building in `values`.
+        qint32 valueCount;
+    };
+
+    struct Path {
+        enum Flag : quint32 {
+            RestrictedToRoads = 0x1,
+            Obsolete = 0x2,
+            HasTarget = 0x4,
+        };
+
+        qint32 type;///< The PathInterface::Type of the path, or NO_PATH.
+        quint32 flags;
+        qint32 wanderingCredits;
+        Location targetTile;
+        qint32 firstTile;///< The first tile of the path in `pathTiles`.
+        qint32 tileCount;
+    };
+
+    struct Character {
+        enum Flag : quint32 {
+            GoingHome = 0x1,
+            WaitingForRegistration = 0x2,
+            MovingTo = 0x4,
+            OnReachedTile = 0x8,///< See MotionHandler::getCurrentTile().
+        };
+
+        quint64 handle;
+        quint64 issuer;
+        quint64 target;///< The target building, for the kinds having one.
+        double x;
+        double y;
+        qint32 conf;///< The index of the key in `characterKeys`.
+        qint32 kind;///< The Character::Kind of the character.
+        quint32 flags;
+        qint32 direction;
+        Location movingFrom;
+        Location movingTo;
+        Path path;
+        qint32 item;///< The index of the key in `itemKeys` of the transported item.
+        qint32 quantity;
+        qint32 countDown;
+        qint32 status;
+    };
+
+    // City.
+    QString title;
+    qint32 year;
+    qint32 month;
+    qint32 cycles;
+    qint32 budget;
+    qint32 population;
+    qint32 workerFrontier;
+    QVector<qint32> workers;///< The workers of each working place, in distribution order.
+
+    // Map.
+    QSize mapSize;
+    Location mapEntryPoint;
+    QByteArray randomGeneratorState;
+    QStringList buildingKeys;
+    QStringList characterKeys;
+    QStringList itemKeys;///< In the order of the item indexes, the order of the stocks.
+    QStringList natureElementKeys;
+    QVector<NatureElement> natureElements;
+    Building civilianEntryPoint;
+    QVector<Building> buildings;
+    QVector<quint32> characterSlots;///< The generation of each slot of the character handles.
+    QVector<quint32> releasedCharacterSlots;
+    QVector<Character> characters;
+    QVector<Location> pathTiles;
+    QVector<qint64> values;
+
+    CitySnapshot();
+
+    /**
+     * @brief Get the index of the key in the table, appending the key first if needed.
+     */
+    static qint32 indexKey(QStringList& keys, const QString& key);
+
+    /**
+     * @brief Indicate if the file is a snapshot, rather than a city file.
+     */
+    static bool isSnapshot(const QString& filePath);
+
+    /**
+     * @throw FileNotFoundException The file cannot be read.
+     * @throw UnexpectedException The file is not a snapshot of a supported version, or is corrupted.
+     */
+    static CitySnapshot load(const QString& filePath);
+
+    /**
+     * @throw UnexpectedException The file cannot be written.
+     */
+    void save(const QString& filePath, const bool compress = true) const;
+};
+
+#endif // CITYSNAPSHOT_HPP
@@ -1,36 +1,232 @@
 #include "Map.hpp"
 
 #include <QtCore/QDebug>
+#include <QtCore/QRandomGenerator>
+#include <sstream>
 
 #include "src/engine/loader/CityLoader.hpp"
+#include "src/engine/loader/CitySnapshot.hpp"
+#include "src/engine/map/path/RandomRoadPath.hpp"
+#include "src/engine/map/path/TargetedPath.hpp"
+#include "src/engine/map/staticElement/natureElement/NatureElement.hpp"
 #include "src/engine/map/Tile.hpp"
 #include "src/engine/processing/CycleDate.hpp"
 #include "src/exceptions/NotImplementedException.hpp"
+#include "src/exceptions/UnexpectedException.hpp"
 #include "src/global/conf/BuildingInformation.hpp"
+#include "src/global/conf/CharacterInformation.hpp"
 #include "src/global/conf/Conf.hpp"
+#include "src/global/conf/ItemInformation.hpp"
 #include "src/global/conf/NatureElementInformation.hpp"
 
 
 
+/**
+ * @brief A dense index of the tiles by coordinates, used while restoring a snapshot.
+ *
+ * A snapshot references hundreds of thousands of locations: resolving them without hashing their coordinates keeps the
+ * restoration linear. The grid also keeps the nature element covering each tile, to restore the targets of the paths.
+ */
+class TileGrid
+{
+    private:
+        struct Cell {
+            Tile* tile;
+            QWeakPointer<NatureElement> natureElement;
+        };
+
+    private:
+        int minX;
+        int columnCount;
+        int lineCount;
+        QVector<Cell> cells;
+
+    public:
+        explicit TileGrid(const QHash<TileCoordinates, owner<Tile*>>& tiles) :
+            minX(0),
+            columnCount(0),
+            lineCount(0),
+            cells()
+        {
+            // The lines of the map go along the diagonals of the coordinates (see Map::generateTiles()).
+            int maxX(0);
+            for (auto tile : tiles) {
+                minX = qMin(minX, tile->coordinates().x());
+                maxX = qMax(maxX, tile->coordinates().x());
+                lineCount = qMax(lineCount, tile->coordinates().y() - tile->coordinates().x() + 1);
+            }
+            columnCount = maxX - minX + 1;
+            cells.resize(lineCount * columnCount);
+            for (auto tile : tiles) {
+                cells[resolveIndex(tile->coordinates().x(), tile->coordinates().y())].tile = tile;
+            }
+        }
+
+        Tile& resolve(const int x, const int y) const
+        {
+            auto index(resolveIndex(x, y));
+            if (index < 0 || !cells.at(index).tile) {
+                throw UnexpectedException(
+                    "The city snapshot references the location (" + QString::number(x) + ", " + QString::number(y) +
+                    "), out of the map."
+                );
+            }
+
+            return *cells.at(index).tile;
+        }
+
+        Tile& resolve(const CitySnapshot::Location& location) const
+        {
+            return resolve(location.x, location.y);
+        }
+
+        Tile& resolve(const TileCoordinates& coordinates) const
+        {
+            return resolve(coordinates.x(), coordinates.y());
+        }
+
+        QWeakPointer<NatureElement> getNatureElement(const CitySnapshot::Location& location) const
+        {
+            resolve(location);
+
+            return cells.at(resolveIndex(location.x, location.y)).natureElement;
+        }
+
+        void setNatureElement(const TileCoordinates& coordinates, const QSharedPointer<NatureElement>& natureElement)
+        {
+            resolve(coordinates);
+            cells[resolveIndex(coordinates.x(), coordinates.y())].natureElement = natureElement;
+        }
+
+    private:
+        int resolveIndex(const int x, const int y) const
+        {
+            auto line(y - x);
+            auto column(x - minX);
+            if (line < 0 || line >= lineCount || column < 0 || column >= columnCount) {
+                return -1;
+            }
+
+            return line * columnCount + column;
+        }
+};
+
+
+
+static QSharedPointer<PathInterface> restorePath(
+    std::mt19937& randomGenerator,
+    const TileGrid& grid,
+    const CitySnapshot& snapshot,
+    const CitySnapshot::Path& record
+) {
+    if (record.type == CitySnapshot::NO_PATH) {
+        return {};
+    }
+
+    switch (static_cast<PathInterface::Type>(record.type)) {
+        case PathInterface::Type::RandomRoad:
+            if (record.tileCount != 2) {
+                break;
+            }
+
+            return QSharedPointer<PathInterface>(new RandomRoadPath(
+                randomGenerator,
+                grid.resolve(snapshot.pathTiles.at(record.firstTile)),
+                grid.resolve(snapshot.pathTiles.at(record.firstTile + 1)),
+                record.wanderingCredits,
+                record.flags & CitySnapshot::Path::Obsolete
+            ));
+
+        case PathInterface::Type::Targeted: {
+            QList<const Tile*> path;
+            path.reserve(record.tileCount);
+            for (int i(0); i < record.tileCount; ++i) {
+                path.append(&grid.resolve(snapshot.pathTiles.at(record.firstTile + i)));
+            }
+
+            QWeakPointer<AbstractStaticElement> target;
+            optional<const Tile*> targetTile(nullptr);
+            if (record.flags & CitySnapshot::Path::HasTarget) {
+                target = grid.getNatureElement(record.targetTile);
+                targetTile = &grid.resolve(record.targetTile);
+            }
+
+            return QSharedPointer<PathInterface>(new TargetedPath(
+                record.flags & CitySnapshot::Path::RestrictedToRoads,
+                path,
+                target,
+                targetTile,
+                record.flags & CitySnapshot::Path::Obsolete
+            ));
+        }
+    }
+
+    throw UnexpectedException("The city snapshot holds an invalid path of type " + QString::number(record.type) + ".");
+}
+
+
+
 Map::Map(
     const Conf& conf,
     CityLoader& loader,
     PopulationRegistryInterface& populationRegistry,
     WorkingPlaceRegistryInterface& workingPlaceRegistry
 ) :
-    size(loader.getMapSize()),
+    Map(conf, loader.getMapSize(), loader.getMapEntryPoint(), populationRegistry, workingPlaceRegistry)
+{
+
+}
+
+
+
+Map::Map(
+    const Conf& conf,
+    const CitySnapshot& snapshot,
+    PopulationRegistryInterface& populationRegistry,
+    WorkingPlaceRegistryInterface& workingPlaceRegistry
+) :
+    Map(
+        conf,
+        snapshot.mapSize,
+        { snapshot.mapEntryPoint.x, snapshot.mapEntryPoint.y },
+        populationRegistry,
+        workingPlaceRegistry
+    )
+{
+    restore(snapshot);
+}
+
+
+
+Map::Map(
+    const Conf& conf,
+    const QSize& size,
+    const TileCoordinates& entryPoint,
+    PopulationRegistryInterface& populationRegistry,
+    WorkingPlaceRegistryInterface& workingPlaceRegistry
+) :
+    conf(conf),
+    size(size),
     tiles(generateTiles(size)),
+    randomGenerator(QRandomGenerator::global()->generate()),
     civilianEntryPoint(CivilianEntryPoint::Create(
+        staticElements,
         dynamicElements,
         conf.getBuildingConf("mapEntryPoint"),
-        { loader.getMapEntryPoint(), 1 },
+        { entryPoint, 1 },
         Direction::West,
-        *tiles.value(loader.getMapEntryPoint().hash()),
-        conf.getCharacterConf("immigrant")
+        *tiles.value(entryPoint),
+        conf.getCharacterConf("immigrant"),
+        randomGenerator
     )),
-    pathGenerator(),
+    pathGenerator(randomGenerator),
     staticElements(dynamicElements, populationRegistry, workingPlaceRegistry, pathGenerator, *civilianEntryPoint.get()),
-    dynamicElements(pathGenerator, staticElements.getBuildingSearchEngine(), staticElements.getNatureElementSearchEngine())
+    dynamicElements(
+        pathGenerator,
+        staticElements,
+        staticElements.getBuildingSearchEngine(),
+        staticElements.getNatureElementSearchEngine()
+    )
 {
 
 }
@@ -51,8 +247,8 @@ QList<TileCoordinates> Map::getShortestPathForRoad(const TileCoordinates& origin
     }
 
     auto pathTiles(pathGenerator.generateShortestPathForRoad(
-        *tiles.value(origin.hash()),
-        *tiles.value(target.hash())
+        *tiles.value(origin),
+        *tiles.value(target)
     ));
 
     QList<TileCoordinates> path;
@@ -93,6 +289,30 @@ QList<CharacterState> Map::getCharactersState() const
 
 
 
+void Map::attachStateJournal(StateJournal& journal)
+{
+    staticElements.attachStateJournal(journal);
+    dynamicElements.attachStateJournal(journal);
+}
+
+
+
+void Map::save(CitySnapshot& snapshot) const
+{
+    snapshot.mapSize = size;
+    std::ostringstream randomGeneratorState;
+    randomGeneratorState << randomGenerator;
+    snapshot.randomGeneratorState = QByteArray::fromStdString(randomGeneratorState.str());
+    snapshot.itemKeys = conf.getAllItemKeys();
+
+    staticElements.save(snapshot);
+    civilianEntryPoint->save(snapshot, snapshot.civilianEntryPoint);
+    snapshot.mapEntryPoint = snapshot.civilianEntryPoint.leftCorner;
+    dynamicElements.save(snapshot);
+}
+
+
+
 void Map::createBuilding(const BuildingInformation& conf, const TileCoordinates& leftCorner, Direction orientation)
 {
     TileArea area(leftCorner, conf.getSize(orientation));
@@ -114,7 +334,7 @@ void Map::createBuilding(const BuildingInformation& conf, const TileCoordinates&
     }
 
     for (auto location : area) {
-        tiles.value(location.hash())->registerBuildingConstruction(conf);
+        tiles.value(location)->registerBuildingConstruction(conf);
     }
 }
 
@@ -124,7 +344,7 @@ void Map::createNatureElement(const NatureElementInformation& conf, const TileAr
 {
     staticElements.generateNatureElement(conf, area);
     for (auto location : area) {
-        tiles.value(location.hash())->registerNatureElement(conf);
+        tiles.value(location)->registerNatureElement(conf);
     }
 }
 
@@ -132,7 +352,7 @@ void Map::createNatureElement(const NatureElementInformation& conf, const TileAr
 
 bool Map::isLocationValid(const TileCoordinates& coordinates) const
 {
-    return tiles.contains(coordinates.hash());
+    return tiles.contains(coordinates);
 }
 
 
@@ -161,7 +381,7 @@ bool Map::isAreaConstructible(const TileArea& area) const
     }
 
     for (auto location : area) {
-        if (!tiles.value(location.hash())->isConstructible()) {
+        if (!tiles.value(location)->isConstructible()) {
             return false;
         }
     }
@@ -183,6 +403,92 @@ void Map::process(const CycleDate& date)
 
 
 
+void Map::restore(const CitySnapshot& snapshot)
+{
+    // The stocks are saved in the order of the items.
+    if (snapshot.itemKeys != conf.getAllItemKeys()) {
+        throw UnexpectedException("The items of the city snapshot do not match the configuration.");
+    }
+
+    QVector<const NatureElementInformation*> natureElementConfs;
+    for (auto& key : snapshot.natureElementKeys) {
+        natureElementConfs.append(&conf.getNatureElementConf(key));
+    }
+    QVector<const BuildingInformation*> buildingConfs;
+    for (auto& key : snapshot.buildingKeys) {
+        buildingConfs.append(&conf.getBuildingConf(key));
+    }
+    QVector<const CharacterInformation*> characterConfs;
+    for (auto& key : snapshot.characterKeys) {
+        characterConfs.append(&conf.getCharacterConf(key));
+    }
+    QVector<const ItemInformation*> itemConfs;
+    for (auto& key : snapshot.itemKeys) {
+        itemConfs.append(&conf.getItemConf(key));
+    }
+
+    TileGrid grid(tiles);
+    std::istringstream randomGeneratorState(snapshot.randomGeneratorState.toStdString());
+    randomGeneratorState >> randomGenerator;
+    if (randomGeneratorState.fail()) {
+        throw UnexpectedException("The random generator state of the city snapshot is corrupted.");
+    }
+
+    // Static elements, in their saved order, so that they get back their handles.
+    for (auto& record : snapshot.natureElements) {
+        auto& natureElementConf(*natureElementConfs.at(record.conf));
+        TileArea area(grid.resolve(record.leftCorner).coordinates(), { record.width, record.height });
+        auto natureElement(staticElements.generateNatureElement(natureElementConf, area));
+        for (auto location : area) {
+            grid.resolve(location).registerNatureElement(natureElementConf);
+            grid.setNatureElement(location, natureElement);
+        }
+    }
+    for (auto& record : snapshot.buildings) {
+        auto& buildingConf(*buildingConfs.at(record.conf));
+        auto orientation(static_cast<Direction>(record.orientation));
+        TileArea area(grid.resolve(record.leftCorner).coordinates(), buildingConf.getSize(orientation));
+        for (auto location : area) {
+            grid.resolve(location);
+        }
+
+        if (buildingConf.getType() == BuildingInformation::Type::Road) {
+            staticElements.generateBuilding(buildingConf, area, orientation);
+        }
+        else {
+            staticElements.generateProcessableBuilding(buildingConf, area, orientation, grid.resolve(record.entryPoint));
+        }
+        for (auto location : area) {
+            grid.resolve(location).registerBuildingConstruction(buildingConf);
+        }
+    }
+
+    // Characters, in their processing order.
+    dynamicElements.restoreSlots(snapshot);
+    for (auto& record : snapshot.characters) {
+        optional<const ItemInformation*> transportedItemConf(nullptr);
+        if (record.item >= 0 && record.item < itemConfs.size()) {
+            transportedItemConf = itemConfs.at(record.item);
+        }
+        dynamicElements.restoreCharacter(
+            *characterConfs.at(record.conf),
+            {
+                record,
+                grid.resolve(record.movingFrom),
+                record.flags & CitySnapshot::Character::MovingTo ? &grid.resolve(record.movingTo) : nullptr,
+                restorePath(randomGenerator, grid, snapshot, record.path),
+            },
+            transportedItemConf
+        );
+    }
+
+    // The states may reference any other element.
+    staticElements.restore(snapshot);
+    civilianEntryPoint->restore(snapshot, snapshot.civilianEntryPoint);
+}
+
+
+
 Tile& Map::getBestBuildingEntryPoint(const TileArea& area) const
 {
     // Fetch a location around the area, starting at the coordinates at north of left point, and turning clockwise
@@ -195,7 +501,7 @@ Tile& Map::getBestBuildingEntryPoint(const TileArea& area) const
     int y(left.y() - 1);
     int moveX(1);
     int moveY(0);
-    auto tile(tiles.value(TileCoordinates::resolveHash(x, y)));
+    auto tile(tiles.value(TileCoordinates(x, y)));
 
     while (!tile || !tile->isRoad()) {
         x += moveX;
@@ -224,7 +530,7 @@ Tile& Map::getBestBuildingEntryPoint(const TileArea& area) const
             throw NotImplementedException("Building need to have a valid entry point.");
         }
 
-        tile = tiles.value(TileCoordinates::resolveHash(x, y));
+        tile = tiles.value(TileCoordinates(x, y));
     }
 
     return *tile;
@@ -232,9 +538,9 @@ Tile& Map::getBestBuildingEntryPoint(const TileArea& area) const
 
 
 
-QHash<QString, owner<Tile*> > Map::generateTiles(const QSize& size)
+QHash<TileCoordinates, owner<Tile*>> Map::generateTiles(const QSize& size)
 {
-    QHash<QString, owner<Tile*>> tiles;
+    QHash<TileCoordinates, owner<Tile*>> tiles;
     int line(0);
     int column(0);
     while (line < size.height()) {
@@ -244,7 +550,7 @@ QHash<QString, owner<Tile*> > Map::generateTiles(const QSize& size)
         int adjust(line > size.width() ? 1 : 2);
         while (column < (size.width() - line + adjust) / 2) {
             auto tile(new Tile(column, line + column));
-            tiles.insert(TileCoordinates::resolveHash(column, line + column), tile);
+            tiles.insert(TileCoordinates(column, line + column), tile);
 
             ++column;
         }
@@ -1,19 +1,24 @@
 #ifndef MAP_HPP
 #define MAP_HPP
 
+#include <QtCore/QHash>
 #include <QtCore/QSharedPointer>
 #include <QtCore/QSize>
+#include <random>
 
 #include "src/engine/map/dynamicElement/DynamicElementRegistry.hpp"
 #include "src/engine/map/path/PathGenerator.hpp"
 #include "src/engine/map/staticElement/building/CivilianEntryPoint.hpp"
 #include "src/engine/map/staticElement/StaticElementRegistry.hpp"
 #include "src/engine/processing/AbstractProcessable.hpp"
+#include "src/global/geometry/TileCoordinates.hpp"
 #include "src/global/state/MapState.hpp"
 #include "src/defines.hpp"
 
 class CityLoader;
 class Conf;
+struct CitySnapshot;
+class StateJournal;
 class Tile;
 
 /**
@@ -28,6 +33,19 @@ class Map : public AbstractProcessable
             PopulationRegistryInterface& populationRegistry,
             WorkingPlaceRegistryInterface& workingPlaceRegistry
         );
+
+        /**
+         * @brief Restore a saved map.
+         *
+         * @throw UnexpectedException The snapshot does not match the configuration or references locations out of the
+         * map.
+         */
+        explicit Map(
+            const Conf& conf,
+            const CitySnapshot& snapshot,
+            PopulationRegistryInterface& populationRegistry,
+            WorkingPlaceRegistryInterface& workingPlaceRegistry
+        );
         ~Map();
 
         QList<TileCoordinates> getShortestPathForRoad(const TileCoordinates& origin, const TileCoordinates& target) const;
@@ -37,6 +55,10 @@ class Map : public AbstractProcessable
         QList<BuildingState> getBuildingsState() const;
         QList<NatureElementState> getNatureElementsState() const;
         QList<CharacterState> getCharactersState() const;
+        void attachStateJournal(StateJournal& journal);
+
+        // Snapshot.
+        void save(CitySnapshot& snapshot) const;
 
         // Elements
         void createBuilding(const BuildingInformation& conf, const TileCoordinates& leftCorner, Direction orientation);
@@ -50,12 +72,23 @@ class Map : public AbstractProcessable
         virtual void process(const CycleDate& date) override;
 
     private:
+        Map(
+            const Conf& conf,
+            const QSize& size,
+            const TileCoordinates& entryPoint,
+            PopulationRegistryInterface& populationRegistry,
+            WorkingPlaceRegistryInterface& workingPlaceRegistry
+        );
+
+        void restore(const CitySnapshot& snapshot);
         Tile& getBestBuildingEntryPoint(const TileArea& area) const;
-        static QHash<QString, owner<Tile*>> generateTiles(const QSize& size);
+        static QHash<TileCoordinates, owner<Tile*>> generateTiles(const QSize& size);
 
     private:
+        const Conf& conf;
         const QSize size;
-        QHash<QString, owner<Tile*>> tiles;
+        QHash<TileCoordinates, owner<Tile*>> tiles;
+        std::mt19937 randomGenerator;///< Used by the whole map, so that its state can be saved with the city.
         QSharedPointer<CivilianEntryPoint> civilianEntryPoint;
         PathGenerator pathGenerator;
         StaticElementRegistry staticElements;
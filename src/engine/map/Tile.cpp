@@ -78,37 +78,37 @@ const Tile::Relatives& Tile::relatives() const
 
 
 
-void Tile::pickRelatives(const QHash<QString, Tile*>& tiles)
+void Tile::pickRelatives(const QHash<TileCoordinates, Tile*>& tiles)
 {
-    auto north(TileCoordinates::resolveHash(_coordinates.x(), _coordinates.y() - 1));
+    TileCoordinates north(_coordinates.x(), _coordinates.y() - 1);
     if (tiles.contains(north)) {
         _relatives.straightNeighbours.append(tiles.value(north));
     }
-    auto east(TileCoordinates::resolveHash(_coordinates.x() + 1, _coordinates.y()));
+    TileCoordinates east(_coordinates.x() + 1, _coordinates.y());
     if (tiles.contains(east)) {
         _relatives.straightNeighbours.append(tiles.value(east));
     }
-    auto south(TileCoordinates::resolveHash(_coordinates.x(), _coordinates.y() + 1));
+    TileCoordinates south(_coordinates.x(), _coordinates.y() + 1);
     if (tiles.contains(south)) {
         _relatives.straightNeighbours.append(tiles.value(south));
     }
-    auto west(TileCoordinates::resolveHash(_coordinates.x() - 1, _coordinates.y()));
+    TileCoordinates west(_coordinates.x() - 1, _coordinates.y());
     if (tiles.contains(west)) {
         _relatives.straightNeighbours.append(tiles.value(west));
     }
-    auto top(TileCoordinates::resolveHash(_coordinates.x() + 1, _coordinates.y() - 1));
+    TileCoordinates top(_coordinates.x() + 1, _coordinates.y() - 1);
     if (tiles.contains(top)) {
         _relatives.diagonalNeighbours.append(tiles.value(top));
     }
-    auto right(TileCoordinates::resolveHash(_coordinates.x() + 1, _coordinates.y() + 1));
+    TileCoordinates right(_coordinates.x() + 1, _coordinates.y() + 1);
     if (tiles.contains(right)) {
         _relatives.diagonalNeighbours.append(tiles.value(right));
     }
-    auto bottom(TileCoordinates::resolveHash(_coordinates.x() - 1, _coordinates.y() + 1));
+    TileCoordinates bottom(_coordinates.x() - 1, _coordinates.y() + 1);
     if (tiles.contains(bottom)) {
         _relatives.diagonalNeighbours.append(tiles.value(bottom));
     }
-    auto left(TileCoordinates::resolveHash(_coordinates.x() - 1, _coordinates.y() - 1));
+    TileCoordinates left(_coordinates.x() - 1, _coordinates.y() - 1);
     if (tiles.contains(left)) {
         _relatives.diagonalNeighbours.append(tiles.value(left));
     }
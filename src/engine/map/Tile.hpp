@@ -35,7 +35,7 @@ class Tile
 
         // Relatives.
         const Relatives& relatives() const;
-        void pickRelatives(const QHash<QString, Tile*>& tiles);
+        void pickRelatives(const QHash<TileCoordinates, Tile*>& tiles);
 
         // Path finding.
         PathFinding& pathFindingData() const;
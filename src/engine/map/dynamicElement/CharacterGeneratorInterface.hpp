@@ -2,48 +2,56 @@
 #define CHARACTERGENERATORINTERFACE_HPP
 
 #include <QtCore/QSharedPointer>
-#include <QtCore/QWeakPointer>
 
+#include "src/global/pointer/Handle.hpp"
+
+class AbstractProcessableBuilding;
 class Character;
 class CharacterInformation;
 class ItemInformation;
 class PathInterface;
-class AbstractProcessableBuilding;
+
+using CharacterHandle = Handle<Character>;
 
 class CharacterGeneratorInterface
 {
     public:
         virtual ~CharacterGeneratorInterface() {};
 
-        virtual QWeakPointer<Character> generateDeliveryMan(
+        virtual CharacterHandle generateDeliveryMan(
             const CharacterInformation& conf,
-            QSharedPointer<AbstractProcessableBuilding> issuer,
+            const AbstractProcessableBuilding& issuer,
             const ItemInformation& transportedItemConf,
             const int transportedQuantity = 0
         ) = 0;
 
-        virtual QWeakPointer<Character> generateImmigrant(
+        virtual CharacterHandle generateImmigrant(
             const CharacterInformation& conf,
-            QSharedPointer<AbstractProcessableBuilding> issuer,
-            QSharedPointer<AbstractProcessableBuilding> target
+            const AbstractProcessableBuilding& issuer,
+            const AbstractProcessableBuilding& target
         ) = 0;
 
-        virtual QWeakPointer<Character> generateMiner(
+        virtual CharacterHandle generateMiner(
             const CharacterInformation& conf,
-            QSharedPointer<AbstractProcessableBuilding> issuer,
+            const AbstractProcessableBuilding& issuer,
             QSharedPointer<PathInterface> path
         ) = 0;
 
-        virtual QWeakPointer<Character> generateStudent(
+        virtual CharacterHandle generateStudent(
             const CharacterInformation& conf,
-            QSharedPointer<AbstractProcessableBuilding> issuer,
-            QSharedPointer<AbstractProcessableBuilding> target
+            const AbstractProcessableBuilding& issuer,
+            const AbstractProcessableBuilding& target
         ) = 0;
 
-        virtual QWeakPointer<Character> generateWanderingCharacter(
+        virtual CharacterHandle generateWanderingCharacter(
             const CharacterInformation& conf,
-            QSharedPointer<AbstractProcessableBuilding> issuer
+            const AbstractProcessableBuilding& issuer
         ) = 0;
+
+        /**
+         * @brief Indicate if the character referenced by the given handle is still on the map.
+         */
+        virtual bool isAlive(const CharacterHandle& handle) const = 0;
 };
 
 #endif // CHARACTERGENERATORINTERFACE_HPP
@@ -1,23 +1,28 @@
 #include "DynamicElementFactory.hpp"
 
-#include "src/engine/map/dynamicElement/character/DeliveryManCharacter.hpp"
-#include "src/engine/map/dynamicElement/character/ImmigrantCharacter.hpp"
-#include "src/engine/map/dynamicElement/character/MinerCharacter.hpp"
-#include "src/engine/map/dynamicElement/character/StudentCharacter.hpp"
-#include "src/engine/map/dynamicElement/character/WanderingCharacter.hpp"
 #include "src/engine/map/path/PathGeneratorInterface.hpp"
 #include "src/engine/map/staticElement/building/AbstractProcessableBuilding.hpp"
+#include "src/exceptions/UnexpectedException.hpp"
 
 
 
 DynamicElementFactory::DynamicElementFactory(
     CharacterDisposerInterface& characterDisposer,
     const PathGeneratorInterface& pathGenerator,
+    const BuildingResolverInterface& buildingResolver,
+    MotionStore& motionStore,
     const BuildingSearchEngine& buildingSearchEngine,
     const NatureElementSearchEngine& natureElementSearchEngine
 ) :
+    deliveryManPool(),
+    immigrantPool(),
+    minerPool(),
+    studentPool(),
+    wanderingCharacterPool(),
     characterDisposer(characterDisposer),
     pathGenerator(pathGenerator),
+    buildingResolver(buildingResolver),
+    motionStore(motionStore),
     buildingSearchEngine(buildingSearchEngine),
     natureElementSearchEngine(natureElementSearchEngine)
 {
@@ -26,72 +31,174 @@ DynamicElementFactory::DynamicElementFactory(
 
 
 
-QSharedPointer<Character> DynamicElementFactory::generateDeliveryMan(
+owner<Character*> DynamicElementFactory::generateDeliveryMan(
     const CharacterInformation& conf,
-    QSharedPointer<AbstractProcessableBuilding> issuer,
+    const AbstractProcessableBuilding& issuer,
     const ItemInformation& transportedItemConf,
     const int transportedQuantity
 ) {
-    return QSharedPointer<Character>(new DeliveryManCharacter(
+    return deliveryManPool.create(
         characterDisposer,
         pathGenerator,
+        buildingResolver,
+        motionStore,
         buildingSearchEngine,
         conf,
         issuer,
         transportedItemConf,
         transportedQuantity
-    ));
+    );
 }
 
 
 
-QSharedPointer<Character> DynamicElementFactory::generateImmigrant(
+owner<Character*> DynamicElementFactory::generateImmigrant(
     const CharacterInformation& conf,
-    QSharedPointer<AbstractProcessableBuilding> issuer,
-    QSharedPointer<AbstractProcessableBuilding> target
+    const AbstractProcessableBuilding& issuer,
+    const AbstractProcessableBuilding& target
 ) {
-    return QSharedPointer<Character>(new ImmigrantCharacter(characterDisposer, pathGenerator, conf, issuer, target));
+    return immigrantPool.create(
+        characterDisposer,
+        pathGenerator,
+        buildingResolver,
+        motionStore,
+        conf,
+        issuer,
+        target
+    );
 }
 
 
 
-QSharedPointer<Character> DynamicElementFactory::generateMiner(
+owner<Character*> DynamicElementFactory::generateMiner(
     const CharacterInformation& conf,
-    QSharedPointer<AbstractProcessableBuilding> issuer,
+    const AbstractProcessableBuilding& issuer,
     QSharedPointer<PathInterface> path
 ) {
-    return QSharedPointer<Character>(new MinerCharacter(
+    return minerPool.create(
         characterDisposer,
         pathGenerator,
+        buildingResolver,
+        motionStore,
         natureElementSearchEngine,
         conf,
         issuer,
         path
-    ));
+    );
 }
 
 
 
-QSharedPointer<Character> DynamicElementFactory::generateStudent(
+owner<Character*> DynamicElementFactory::generateStudent(
     const CharacterInformation& conf,
-    QSharedPointer<AbstractProcessableBuilding> issuer,
-    QSharedPointer<AbstractProcessableBuilding> target
+    const AbstractProcessableBuilding& issuer,
+    const AbstractProcessableBuilding& target
 ) {
-    return QSharedPointer<Character>(new StudentCharacter(
+    return studentPool.create(
         characterDisposer,
         pathGenerator,
+        buildingResolver,
+        motionStore,
         conf,
         issuer,
         target,
-        pathGenerator.generateShortestRoadPathTo(issuer->getEntryPointTile(), target->getEntryPointTile())
-    ));
+        pathGenerator.generateShortestRoadPathTo(issuer.getEntryPointTile(), target.getEntryPointTile())
+    );
+}
+
+
+
+owner<Character*> DynamicElementFactory::generateWanderingCharacter(
+    const CharacterInformation& conf,
+    const AbstractProcessableBuilding& issuer
+) {
+    return wanderingCharacterPool.create(
+        characterDisposer,
+        pathGenerator,
+        buildingResolver,
+        motionStore,
+        conf,
+        issuer
+    );
 }
 
 
 
-QSharedPointer<Character> DynamicElementFactory::generateWanderingCharacter(
+owner<Character*> DynamicElementFactory::restoreCharacter(
     const CharacterInformation& conf,
-    QSharedPointer<AbstractProcessableBuilding> issuer
+    const Character::Restoration& restoration,
+    optional<const ItemInformation*> transportedItemConf
 ) {
-    return QSharedPointer<Character>(new WanderingCharacter(characterDisposer, pathGenerator, conf, issuer));
+    switch (static_cast<Character::Kind>(restoration.record.kind)) {
+        case Character::Kind::DeliveryMan:
+            if (!transportedItemConf) {
+                throw UnexpectedException("A saved delivery man does not transport any known item.");
+            }
+            return deliveryManPool.create(
+                characterDisposer,
+                pathGenerator,
+                buildingResolver,
+                motionStore,
+                buildingSearchEngine,
+                conf,
+                *transportedItemConf,
+                restoration
+            );
+
+        case Character::Kind::Immigrant:
+            return immigrantPool.create(characterDisposer, pathGenerator, buildingResolver, motionStore, conf, restoration);
+
+        case Character::Kind::Miner:
+            return minerPool.create(
+                characterDisposer,
+                pathGenerator,
+                buildingResolver,
+                motionStore,
+                natureElementSearchEngine,
+                conf,
+                restoration
+            );
+
+        case Character::Kind::Student:
+            return studentPool.create(characterDisposer, pathGenerator, buildingResolver, motionStore, conf, restoration);
+
+        case Character::Kind::Wandering:
+            return wanderingCharacterPool.create(
+                characterDisposer,
+                pathGenerator,
+                buildingResolver,
+                motionStore,
+                conf,
+                restoration
+            );
+    }
+
+    throw UnexpectedException("Unknown kind of saved character: " + QString::number(restoration.record.kind) + ".");
+}
+
+
+
+void DynamicElementFactory::destroyCharacter(owner<Character*> character)
+{
+    switch (character->getKind()) {
+        case Character::Kind::DeliveryMan:
+            deliveryManPool.destroy(static_cast<DeliveryManCharacter*>(character));
+            break;
+
+        case Character::Kind::Immigrant:
+            immigrantPool.destroy(static_cast<ImmigrantCharacter*>(character));
+            break;
+
+        case Character::Kind::Miner:
+            minerPool.destroy(static_cast<MinerCharacter*>(character));
+            break;
+
+        case Character::Kind::Student:
+            studentPool.destroy(static_cast<StudentCharacter*>(character));
+            break;
+
+        case Character::Kind::Wandering:
+            wanderingCharacterPool.destroy(static_cast<WanderingCharacter*>(character));
+            break;
+    }
 }
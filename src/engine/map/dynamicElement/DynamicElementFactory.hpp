@@ -3,16 +3,32 @@
 
 #include <QtCore/QSharedPointer>
 
+#include "src/engine/map/dynamicElement/character/DeliveryManCharacter.hpp"
+#include "src/engine/map/dynamicElement/character/ImmigrantCharacter.hpp"
+#include "src/engine/map/dynamicElement/character/MinerCharacter.hpp"
+#include "src/engine/map/dynamicElement/character/StudentCharacter.hpp"
+#include "src/engine/map/dynamicElement/character/WanderingCharacter.hpp"
+#include "src/global/pointer/ObjectPool.hpp"
+
 class AbstractProcessableBuilding;
+class BuildingResolverInterface;
 class BuildingSearchEngine;
 class Character;
 class CharacterDisposerInterface;
 class CharacterInformation;
 class ItemInformation;
+class MotionStore;
 class NatureElementSearchEngine;
 class PathGeneratorInterface;
 class PathInterface;
 
+/**
+ * @brief Creates the characters.
+ *
+ * Characters are short-lived and constantly created, so each character type is allocated from its own pool. The pools
+ * must outlive the characters: the factory must be destroyed after all the characters it created. The characters are
+ * returned as raw pointers: the caller owns them and must give them back through destroyCharacter().
+ */
 class DynamicElementFactory
 {
         Q_DISABLE_COPY_MOVE(DynamicElementFactory)
@@ -21,43 +37,69 @@ class DynamicElementFactory
         DynamicElementFactory(
             CharacterDisposerInterface& characterDisposer,
             const PathGeneratorInterface& pathGenerator,
+            const BuildingResolverInterface& buildingResolver,
+            MotionStore& motionStore,
             const BuildingSearchEngine& buildingSearchEngine,
             const NatureElementSearchEngine& natureElementSearchEngine
         );
 
-        QSharedPointer<Character> generateDeliveryMan(
+        owner<Character*> generateDeliveryMan(
             const CharacterInformation& conf,
-            QSharedPointer<AbstractProcessableBuilding> issuer,
+            const AbstractProcessableBuilding& issuer,
             const ItemInformation& transportedItemConf,
             const int transportedQuantity = 0
         );
 
-        QSharedPointer<Character> generateImmigrant(
+        owner<Character*> generateImmigrant(
             const CharacterInformation& conf,
-            QSharedPointer<AbstractProcessableBuilding> issuer,
-            QSharedPointer<AbstractProcessableBuilding> target
+            const AbstractProcessableBuilding& issuer,
+            const AbstractProcessableBuilding& target
         );
 
-        QSharedPointer<Character> generateMiner(
+        owner<Character*> generateMiner(
             const CharacterInformation& conf,
-            QSharedPointer<AbstractProcessableBuilding> issuer,
+            const AbstractProcessableBuilding& issuer,
             QSharedPointer<PathInterface> path
         );
 
-        QSharedPointer<Character> generateStudent(
+        owner<Character*> generateStudent(
             const CharacterInformation& conf,
-            QSharedPointer<AbstractProcessableBuilding> issuer,
-            QSharedPointer<AbstractProcessableBuilding> target
+            const AbstractProcessableBuilding& issuer,
+            const AbstractProcessableBuilding& target
         );
 
-        QSharedPointer<Character> generateWanderingCharacter(
+        owner<Character*> generateWanderingCharacter(
             const CharacterInformation& conf,
-            QSharedPointer<AbstractProcessableBuilding> issuer
+            const AbstractProcessableBuilding& issuer
         );
 
+        /**
+         * @brief Restore a saved character of any kind.
+         *
+         * @param transportedItemConf The item transported by the delivery men, null for the other kinds.
+         * @throw UnexpectedException The kind of the character is unknown, or a delivery man has no item.
+         */
+        owner<Character*> restoreCharacter(
+            const CharacterInformation& conf,
+            const Character::Restoration& restoration,
+            optional<const ItemInformation*> transportedItemConf
+        );
+
+        /**
+         * @brief Destroy a character created by this factory and give its memory back to the pool of its kind.
+         */
+        void destroyCharacter(owner<Character*> character);
+
     private:
+        ObjectPool<DeliveryManCharacter> deliveryManPool;
+        ObjectPool<ImmigrantCharacter> immigrantPool;
+        ObjectPool<MinerCharacter> minerPool;
+        ObjectPool<StudentCharacter> studentPool;
+        ObjectPool<WanderingCharacter> wanderingCharacterPool;
         CharacterDisposerInterface& characterDisposer;
         const PathGeneratorInterface& pathGenerator;
+        const BuildingResolverInterface& buildingResolver;
+        MotionStore& motionStore;
         const BuildingSearchEngine& buildingSearchEngine;
         const NatureElementSearchEngine& natureElementSearchEngine;
 };
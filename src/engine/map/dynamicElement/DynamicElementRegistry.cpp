@@ -4,97 +4,98 @@
 
 #include "src/engine/map/dynamicElement/character/Character.hpp"
 #include "src/engine/map/dynamicElement/DynamicElementFactory.hpp"
+#include "src/engine/StateJournal.hpp"
+#include "src/exceptions/UnexpectedException.hpp"
 
 
 
 DynamicElementRegistry::DynamicElementRegistry(
     const PathGeneratorInterface& pathGenerator,
+    const BuildingResolverInterface& buildingResolver,
     const BuildingSearchEngine& buildingSearchEngine,
     const NatureElementSearchEngine& natureElementSearchEngine
 ) :
-    factory(*this, pathGenerator, buildingSearchEngine, natureElementSearchEngine),
+    motionStore(),
+    factory(*this, pathGenerator, buildingResolver, motionStore, buildingSearchEngine, natureElementSearchEngine),
     characters(),
     waitingForRegistrationList(),
-    waitingForUnregistrationList()
+    waitingForUnregistrationList(),
+    stateJournal(nullptr)
 {
 
 }
 
 
 
-QWeakPointer<Character> DynamicElementRegistry::generateDeliveryMan(
+DynamicElementRegistry::~DynamicElementRegistry()
+{
+    for (auto character : characters) {
+        factory.destroyCharacter(character);
+    }
+}
+
+
+
+CharacterHandle DynamicElementRegistry::generateDeliveryMan(
     const CharacterInformation& conf,
-    QSharedPointer<AbstractProcessableBuilding> issuer,
+    const AbstractProcessableBuilding& issuer,
     const ItemInformation& transportedItemConf,
     const int transportedQuantity
 ) {
-    auto character(factory.generateDeliveryMan(conf, issuer, transportedItemConf, transportedQuantity));
-    assert(!character.isNull());
-    waitingForRegistrationList.append(character);
-
-    return character;
+    return registerCharacter(factory.generateDeliveryMan(conf, issuer, transportedItemConf, transportedQuantity));
 }
 
 
 
-QWeakPointer<Character> DynamicElementRegistry::generateImmigrant(
+CharacterHandle DynamicElementRegistry::generateImmigrant(
     const CharacterInformation& conf,
-    QSharedPointer<AbstractProcessableBuilding> issuer,
-    QSharedPointer<AbstractProcessableBuilding> target
+    const AbstractProcessableBuilding& issuer,
+    const AbstractProcessableBuilding& target
 ) {
-    auto character(factory.generateImmigrant(conf, issuer, target));
-    assert(!character.isNull());
-    waitingForRegistrationList.append(character);
-
-    return character;
+    return registerCharacter(factory.generateImmigrant(conf, issuer, target));
 }
 
 
 
-QWeakPointer<Character> DynamicElementRegistry::generateMiner(
+CharacterHandle DynamicElementRegistry::generateMiner(
     const CharacterInformation& conf,
-    QSharedPointer<AbstractProcessableBuilding> issuer,
+    const AbstractProcessableBuilding& issuer,
     QSharedPointer<PathInterface> path
 ) {
-    auto character(factory.generateMiner(conf, issuer, path));
-    assert(!character.isNull());
-    waitingForRegistrationList.append(character);
-
-    return character;
+    return registerCharacter(factory.generateMiner(conf, issuer, path));
 }
 
 
 
-QWeakPointer<Character> DynamicElementRegistry::generateStudent(
+CharacterHandle DynamicElementRegistry::generateStudent(
     const CharacterInformation& conf,
-    QSharedPointer<AbstractProcessableBuilding> issuer,
-    QSharedPointer<AbstractProcessableBuilding> target
+    const AbstractProcessableBuilding& issuer,
+    const AbstractProcessableBuilding& target
 ) {
-    auto character(factory.generateStudent(conf, issuer, target));
-    assert(!character.isNull());
-    waitingForRegistrationList.append(character);
-
-    return character;
+    return registerCharacter(factory.generateStudent(conf, issuer, target));
 }
 
 
 
-QWeakPointer<Character> DynamicElementRegistry::generateWanderingCharacter(
+CharacterHandle DynamicElementRegistry::generateWanderingCharacter(
     const CharacterInformation& conf,
-    QSharedPointer<AbstractProcessableBuilding> issuer
+    const AbstractProcessableBuilding& issuer
 ) {
-    auto character(factory.generateWanderingCharacter(conf, issuer));
-    assert(!character.isNull());
-    waitingForRegistrationList.append(character);
+    return registerCharacter(factory.generateWanderingCharacter(conf, issuer));
+}
+
+
 
-    return character;
+bool DynamicElementRegistry::isAlive(const CharacterHandle& handle) const
+{
+    return characters.isAlive(handle);
 }
 
 
 
 void DynamicElementRegistry::clearCharacter(Character& character)
 {
-    waitingForUnregistrationList.append(&character);
+    waitingForUnregistrationList.append(character.getHandle());
 }
 
 
@@ -111,24 +112,118 @@ QList<CharacterState> DynamicElementRegistry::getCharactersState() const
 
 
 
+void DynamicElementRegistry::attachStateJournal(StateJournal& journal)
+{
+    stateJournal = &journal;
+    for (auto character : characters) {
+        character->setStateJournal(stateJournal);
+        journal.registerCharacter(*character);
+    }
+}
+
+
+
+void DynamicElementRegistry::save(CitySnapshot& snapshot) const
+{
+    // Resizing zeroes the records, padding included, before they are written as raw memory.
+    snapshot.characters.resize(characters.size());
+    for (int i(0); i < characters.size(); ++i) {
+        auto character(characters.at(i));
+        auto& record(snapshot.characters[i]);
+        character->save(snapshot, record);
+        if (waitingForRegistrationList.contains(character->getHandle())) {
+            record.flags |= CitySnapshot::Character::WaitingForRegistration;
+        }
+    }
+    snapshot.characterSlots = characters.getSlotGenerations();
+    snapshot.releasedCharacterSlots = characters.getReleasedSlots();
+}
+
+
+
+void DynamicElementRegistry::restoreSlots(const CitySnapshot& snapshot)
+{
+    characters.restoreSlots(snapshot.characterSlots, snapshot.releasedCharacterSlots);
+}
+
+
+
+void DynamicElementRegistry::restoreCharacter(
+    const CharacterInformation& conf,
+    const Character::Restoration& restoration,
+    optional<const ItemInformation*> transportedItemConf
+) {
+    auto character(factory.restoreCharacter(conf, restoration, transportedItemConf));
+    auto handle(CharacterHandle::unpack(restoration.record.handle));
+    if (!characters.restore(character, handle)) {
+        factory.destroyCharacter(character);
+        throw UnexpectedException("A saved character has an invalid handle.");
+    }
+    character->setHandle(handle);
+    if (stateJournal) {
+        character->setStateJournal(stateJournal);
+        stateJournal->registerCharacter(*character);
+    }
+
+    if (restoration.record.flags & CitySnapshot::Character::WaitingForRegistration) {
+        waitingForRegistrationList.append(handle);
+    }
+    else {
+        character->activateMotion();
+    }
+}
+
+
+
 void DynamicElementRegistry::process(const CycleDate& date)
 {
-    // Note: The order below is important: current, unregistration and finally registration.
+    // Note: The order below is important: motion, current, unregistration and finally registration.
 
-    // Process current character list.
-    for (auto character : characters) {
-        character->process(date);
+    // Move all the activated characters at once. A character taking a new path before following its motion makes its
+    // step again towards the new path (see MotionHandler::takePath()).
+    motionStore.moveAll();
+
+    // Process current character list. The characters waiting for registration have been appended to the table since
+    // the last pass, with no removal meanwhile: they are the last ones and are skipped, as well as the ones generated
+    // during this loop.
+    for (int i(0), count(characters.size() - waitingForRegistrationList.size()); i < count; ++i) {
+        characters.at(i)->process(date);
     }
 
     // Process unregistration.
-    for (auto characterToRemove : waitingForUnregistrationList) {
-        characters.remove(characterToRemove);
+    for (auto& handle : waitingForUnregistrationList) {
+        auto character(characters.resolve(handle));
+        if (character) {
+            if (stateJournal) {
+                stateJournal->unregisterCharacter(*character);
+            }
+            characters.remove(handle);
+            factory.destroyCharacter(character);
+        }
     }
     waitingForUnregistrationList.clear();
 
-    // Process registration.
-    for (auto& newCharacter : waitingForRegistrationList) {
-        characters.insert(newCharacter.get(), newCharacter);
+    // Process registration: the new characters start moving and being processed on next cycle.
+    for (auto& handle : waitingForRegistrationList) {
+        auto character(characters.resolve(handle));
+        if (character) {
+            character->activateMotion();
+        }
     }
     waitingForRegistrationList.clear();
 }
+
+
+
+CharacterHandle DynamicElementRegistry::registerCharacter(owner<Character*> character)
+{
+    assert(character);
+    character->setHandle(characters.insert(character));
+    waitingForRegistrationList.append(character->getHandle());
+    if (stateJournal) {
+        character->setStateJournal(stateJournal);
+        stateJournal->registerCharacter(*character);
+    }
+
+    return character->getHandle();
+}
@@ -1,18 +1,29 @@
 #ifndef DYNAMICELEMENTREGISTRY_HPP
 #define DYNAMICELEMENTREGISTRY_HPP
 
-#include <QtCore/QHash>
 #include <QtCore/QList>
 #include <QtCore/QSharedPointer>
 
+#include "src/engine/loader/CitySnapshot.hpp"
 #include "src/engine/map/dynamicElement/CharacterDisposerInterface.hpp"
 #include "src/engine/map/dynamicElement/CharacterGeneratorInterface.hpp"
 #include "src/engine/map/dynamicElement/DynamicElementFactory.hpp"
+#include "src/engine/map/dynamicElement/MotionStore.hpp"
 #include "src/engine/processing/AbstractProcessable.hpp"
+#include "src/global/pointer/Handle.hpp"
 #include "src/global/state/CharacterState.hpp"
 
 class Character;
+class StateJournal;
 
+/**
+ * @brief Owns all the characters of the map.
+ *
+ * Characters are kept in a dense handle table, so they are processed in a deterministic order: the order of creation,
+ * altered only by the swap-remove of the destroyed characters. A new character gets its handle right away but waits in
+ * the table for its registration, at the end of the next pass of the registry: it is only moved and processed from the
+ * following cycle on.
+ */
 class DynamicElementRegistry : public AbstractProcessable, public CharacterDisposerInterface, public CharacterGeneratorInterface
 {
         Q_DISABLE_COPY_MOVE(DynamicElementRegistry)
@@ -20,48 +31,88 @@ class DynamicElementRegistry : public AbstractProcessable, public CharacterDispo
     public:
         explicit DynamicElementRegistry(
             const PathGeneratorInterface& pathGenerator,
+            const BuildingResolverInterface& buildingResolver,
             const BuildingSearchEngine& buildingSearchEngine,
             const NatureElementSearchEngine& natureElementSearchEngine
         );
+        ~DynamicElementRegistry();
 
-        virtual QWeakPointer<Character> generateDeliveryMan(
+        virtual CharacterHandle generateDeliveryMan(
             const CharacterInformation& conf,
-            QSharedPointer<AbstractProcessableBuilding> issuer,
+            const AbstractProcessableBuilding& issuer,
             const ItemInformation& transportedItemConf,
             const int transportedQuantity = 0
         ) override;
-        virtual QWeakPointer<Character> generateImmigrant(
+        virtual CharacterHandle generateImmigrant(
             const CharacterInformation& conf,
-            QSharedPointer<AbstractProcessableBuilding> issuer,
-            QSharedPointer<AbstractProcessableBuilding> target
+            const AbstractProcessableBuilding& issuer,
+            const AbstractProcessableBuilding& target
         ) override;
-        virtual QWeakPointer<Character> generateMiner(
+        virtual CharacterHandle generateMiner(
             const CharacterInformation& conf,
-            QSharedPointer<AbstractProcessableBuilding> issuer,
+            const AbstractProcessableBuilding& issuer,
             QSharedPointer<PathInterface> path
         ) override;
-        virtual QWeakPointer<Character> generateStudent(
+        virtual CharacterHandle generateStudent(
             const CharacterInformation& conf,
-            QSharedPointer<AbstractProcessableBuilding> issuer,
-            QSharedPointer<AbstractProcessableBuilding> target
+            const AbstractProcessableBuilding& issuer,
+            const AbstractProcessableBuilding& target
         ) override;
-        virtual QWeakPointer<Character> generateWanderingCharacter(
+        virtual CharacterHandle generateWanderingCharacter(
             const CharacterInformation& conf,
-            QSharedPointer<AbstractProcessableBuilding> issuer
+            const AbstractProcessableBuilding& issuer
         ) override;
+        virtual bool isAlive(const CharacterHandle& handle) const override;
 
         virtual void clearCharacter(Character& character) override;
 
         // State.
         QList<CharacterState> getCharactersState() const;
 
+        /**
+         * @brief Register all the characters in the journal, then let them report their changes to it.
+         *
+         * The characters generated or destroyed afterwards are reported as well. The journal must outlive the registry.
+         */
+        void attachStateJournal(StateJournal& journal);
+
+        // Snapshot.
+        /**
+         * @brief Save the characters in their processing order, along with the slots of their handles.
+         */
+        void save(CitySnapshot& snapshot) const;
+
+        /**
+         * @brief Prepare the handle slots of an empty registry, before restoring the characters.
+         */
+        void restoreSlots(const CitySnapshot& snapshot);
+
+        /**
+         * @brief Restore a saved character under the handle it had, in the order of the snapshot.
+         *
+         * @throw UnexpectedException The handle of the character is not valid.
+         */
+        void restoreCharacter(
+            const CharacterInformation& conf,
+            const Character::Restoration& restoration,
+            optional<const ItemInformation*> transportedItemConf
+        );
+
         virtual void process(const CycleDate& date) override;
 
     private:
-        DynamicElementFactory factory;
-        QHash<const Character*, QSharedPointer<Character>> characters;
-        QList<QSharedPointer<Character>> waitingForRegistrationList;
-        QList<const Character*> waitingForUnregistrationList;
+        /**
+         * @brief Take ownership of a newly created character and queue its registration.
+         */
+        CharacterHandle registerCharacter(owner<Character*> character);
+
+    private:
+        MotionStore motionStore;///< Must outlive the characters.
+        DynamicElementFactory factory;///< Must outlive the characters.
+        HandleTable<Character> characters;///< Owns the characters.
+        QList<CharacterHandle> waitingForRegistrationList;///< Always the last characters of the table.
+        QList<CharacterHandle> waitingForUnregistrationList;
+        optional<StateJournal*> stateJournal;
 };
 
 #endif // DYNAMICELEMENTREGISTRY_HPP
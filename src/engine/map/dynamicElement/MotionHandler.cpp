@@ -1,7 +1,6 @@
 #include "MotionHandler.hpp"
 
-#include <QtCore/QtMath>
-
+#include "src/engine/map/dynamicElement/MotionStore.hpp"
 #include "src/engine/map/path/PathInterface.hpp"
 #include "src/engine/map/path/TargetedPath.hpp"
 #include "src/engine/map/staticElement/building/AbstractBuilding.hpp"
@@ -11,28 +10,48 @@
 
 
 
-MotionHandler::MotionHandler(const qreal speed, const Tile& initialTile) :
+MotionHandler::MotionHandler(MotionStore& store, const qreal speed, const Tile& initialTile) :
+    store(store),
+    index(store.allocate(initialTile.coordinates().toDynamicElementCoordinates())),
     speed(speed),
     path(),
-    location(initialTile.coordinates().toDynamicElementCoordinates()),
     movingFrom(&initialTile),
     movingTo(nullptr),
-    direction(Direction::West)
+    followedMove(store.getMoveCount()),
+    isOnReachedTile(false)
 {
 
 }
 
 
 
-const DynamicElementCoordinates& MotionHandler::getCurrentLocation() const
+MotionHandler::~MotionHandler()
+{
+    store.release(index);
+}
+
+
+
+void MotionHandler::activate()
 {
-    return location;
+    store.activate(index, speed);
+}
+
+
+
+DynamicElementCoordinates MotionHandler::getCurrentLocation() const
+{
+    return store.getLocation(index);
 }
 
 
 
 const Tile& MotionHandler::getCurrentTile() const
 {
+    if (isOnReachedTile) {
+        return *movingFrom;
+    }
+
     return movingTo ? *movingTo : *movingFrom;
 }
 
@@ -40,7 +59,7 @@ const Tile& MotionHandler::getCurrentTile() const
 
 Direction MotionHandler::getCurrentDirection() const
 {
-    return direction;
+    return store.getDirection(index);
 }
 
 
@@ -55,7 +74,7 @@ bool MotionHandler::isPathObsolete() const
 bool MotionHandler::isPathCompleted() const
 {
     return !path.isNull() && path->isCompleted() && (
-        !movingTo || location == movingTo->coordinates().toDynamicElementCoordinates()
+        !movingTo || store.getLocation(index) == movingTo->coordinates().toDynamicElementCoordinates()
     );
 }
 
@@ -63,22 +82,22 @@ bool MotionHandler::isPathCompleted() const
 
 QWeakPointer<AbstractStaticElement> MotionHandler::target() const
 {
-    if (path.isNull()) {
+    if (path.isNull() || path->getType() != PathInterface::Type::Targeted) {
         return {};
     }
 
-    auto targetedPath(path.dynamicCast<TargetedPath>());
-    if (targetedPath.isNull()) {
-        return {};
-    }
-
-    return targetedPath->target();
+    return static_cast<const TargetedPath&>(*path).target();
 }
 
 
 
 void MotionHandler::takePath(QSharedPointer<PathInterface> path)
 {
+    auto isStepPending(followedMove != store.getMoveCount());
+    if (isStepPending) {
+        store.cancelStep(index);
+    }
+
     this->path = path;
     movingTo = nullptr;
     if (!path.isNull() && path->isNextTileValid()) {
@@ -89,63 +108,99 @@ void MotionHandler::takePath(QSharedPointer<PathInterface> path)
                 movingTo = &path->getNextTile();
             }
         }
-        direction = resolveDirection();
+        store.setDirection(index, resolveDirection());
+    }
+    updateTarget();
+
+    if (isStepPending) {
+        store.step(index);
     }
 }
 
 
 
-bool MotionHandler::move()
+bool MotionHandler::updateMotion()
 {
-    if (path.isNull()) {
+    followedMove = store.getMoveCount();
+    isOnReachedTile = false;
+    if (!store.hasMoved(index)) {
         return false;
     }
 
-    if (!movingTo) {
-        return false;
+    if (store.hasArrived(index)) {
+        updateTarget();
+        isOnReachedTile = true;
     }
 
-    if (location == movingTo->coordinates().toDynamicElementCoordinates()) {
-        movingFrom = movingTo;
-        movingTo = nullptr;
-        if (path->isNextTileValid()) {
-            movingTo = &path->getNextTile();
-        }
-        direction = resolveDirection();
-    }
+    return true;
+}
 
-    if (!movingTo) {
-        return false;
+
+
+void MotionHandler::save(CitySnapshot& snapshot, CitySnapshot::Character& record) const
+{
+    auto location(store.getLocation(index));
+    record.x = location.x();
+    record.y = location.y();
+    record.direction = static_cast<qint32>(store.getDirection(index));
+    record.movingFrom = { movingFrom->coordinates().x(), movingFrom->coordinates().y() };
+    if (movingTo) {
+        record.flags |= CitySnapshot::Character::MovingTo;
+        record.movingTo = { movingTo->coordinates().x(), movingTo->coordinates().y() };
+    }
+    if (isOnReachedTile) {
+        record.flags |= CitySnapshot::Character::OnReachedTile;
     }
+    if (path.isNull()) {
+        record.path.type = CitySnapshot::NO_PATH;
+    }
+    else {
+        path->save(snapshot, record.path);
+    }
+}
+
+
 
-    return moveToTarget();
+void MotionHandler::restore(
+    const DynamicElementCoordinates& location,
+    const Direction direction,
+    optional<const Tile*> movingTo,
+    QSharedPointer<PathInterface> path,
+    const bool isOnReachedTile
+) {
+    this->path = path;
+    this->movingTo = movingTo;
+    this->isOnReachedTile = isOnReachedTile;
+    store.setLocation(index, location);
+    store.setDirection(index, direction);
+    if (movingTo) {
+        store.setTarget(index, movingTo->coordinates());
+    }
+    else {
+        store.clearTarget(index);
+    }
 }
 
 
 
-bool MotionHandler::moveToTarget()
+void MotionHandler::updateTarget()
 {
-    bool hasMoved(false);
-    auto& movingToCoordinates(movingTo->coordinates());
-    if (movingToCoordinates.x() > location.x()) {
-        location = { qMin(location.x() + speed, static_cast<qreal>(movingToCoordinates.x())), location.y() };
-        hasMoved = true;
-    }
-    else if (movingToCoordinates.x() < location.x()) {
-        location = { qMax(location.x() - speed, static_cast<qreal>(movingToCoordinates.x())), location.y() };
-        hasMoved = true;
+    auto location(store.getLocation(index));
+    while (movingTo && location == movingTo->coordinates().toDynamicElementCoordinates()) {
+        movingFrom = movingTo;
+        movingTo = nullptr;
+        if (path->isNextTileValid()) {
+            movingTo = &path->getNextTile();
+        }
+        store.setDirection(index, resolveDirection());
     }
 
-    if (movingToCoordinates.y() > location.y()) {
-        location = { location.x(), qMin(location.y() + speed, static_cast<qreal>(movingToCoordinates.y())) };
-        hasMoved = true;
+    if (movingTo) {
+        store.setTarget(index, movingTo->coordinates());
     }
-    else if (movingToCoordinates.y() < location.y()) {
-        location = { location.x(), qMax(location.y() - speed, static_cast<qreal>(movingToCoordinates.y())) };
-        hasMoved = true;
+    else {
+        store.clearTarget(index);
     }
-
-    return hasMoved;
 }
 
 
@@ -155,21 +210,16 @@ Direction MotionHandler::resolveDirection() const
     TileCoordinates next;
     if (!movingTo) {
         // Check if the path is completed and ends with a target. If so, take the direction of the target.
-        if (path.isNull() || !path->isCompleted()) {
-            return direction;
-        }
-
-        auto targetedPath(path.dynamicCast<TargetedPath>());
-        if (targetedPath.isNull()) {
-            return direction;
+        if (path.isNull() || !path->isCompleted() || path->getType() != PathInterface::Type::Targeted) {
+            return store.getDirection(index);
         }
 
-        auto target(targetedPath->target().toStrongRef());
-        if (target.isNull()) {
-            return direction;
+        auto& targetedPath(static_cast<const TargetedPath&>(*path));
+        if (targetedPath.target().isNull()) {
+            return store.getDirection(index);
         }
 
-        next = targetedPath->targetTile().coordinates();
+        next = targetedPath.targetTile().coordinates();
     }
     else {
         next = movingTo->coordinates();
@@ -3,56 +3,109 @@
 
 #include <QtCore/QSharedPointer>
 
+#include "src/engine/loader/CitySnapshot.hpp"
 #include "src/global/geometry/DynamicElementCoordinates.hpp"
 #include "src/global/Direction.hpp"
+#include "src/defines.hpp"
 
 class AbstractStaticElement;
+class MotionStore;
 class PathInterface;
 class Tile;
 
 /**
  * @brief Handle the motion of characters on the map.
+ *
+ * The location, the speed, the target coordinates and the direction are kept in a slot of the registry's motion store.
+ * The store moves all the characters at once, then each handler follows its path: when the tile it was moving to is
+ * reached, the next tile of the path becomes the new target of the slot. A path taken before following the motion of
+ * the cycle replaces the step of the cycle, so that the character starts moving on its new path right away.
  */
 class MotionHandler
 {
+        Q_DISABLE_COPY_MOVE(MotionHandler)
+
     private:
+        MotionStore& store;
+        const int index;///< The index of the slot in the motion store.
         const qreal speed;
         QSharedPointer<PathInterface> path;///< The path to follow.
-        DynamicElementCoordinates location;///< The current coordinates of the element.
         const Tile* movingFrom;///< The tile the element is moving from.
         const Tile* movingTo;///< The tile the element is moving to.
-        Direction direction;///< The direction the character is going to.
+        quint32 followedMove;///< The last move of the store followed by the handler (see MotionStore::getMoveCount()).
+        bool isOnReachedTile;///< Whether `movingFrom` was reached by the last followed move.
 
     public:
         /**
          * @brief Construct a new motion handler.
          *
+         * The handler does not move until it is activated.
+         *
+         * @param store       The store holding the motion state.
          * @param speed       The speed of the character.
          * @param initialTile The initial tile of the character.
          */
-        MotionHandler(const qreal speed, const Tile& initialTile);
+        MotionHandler(MotionStore& store, const qreal speed, const Tile& initialTile);
+        ~MotionHandler();
+
+        /**
+         * @brief Let the motion store move the character.
+         */
+        void activate();
+
+        DynamicElementCoordinates getCurrentLocation() const;
 
-        const DynamicElementCoordinates& getCurrentLocation() const;
+        /**
+         * @brief Get the tile the character is moving to.
+         *
+         * A reached tile is left right away for the next tile of the path, but it stays the current tile until the
+         * next move is followed, as if the character was still standing on it.
+         */
         const Tile& getCurrentTile() const;
         Direction getCurrentDirection() const;
         bool isPathObsolete() const;
         bool isPathCompleted() const;
         QWeakPointer<AbstractStaticElement> target() const;
 
+        /**
+         * @brief Follow a new path.
+         *
+         * If the step of the current cycle was not followed yet, it is made again towards the first tile of the new
+         * path. Otherwise, the character starts moving on the next cycle.
+         */
         void takePath(QSharedPointer<PathInterface> path);
 
         /**
-         * @brief Move and return the new location.
+         * @brief Follow the path according to the last motion processed by the store.
          * @return `true` if the location has changed.
          */
-        bool move();
+        bool updateMotion();
+
+        /**
+         * @brief Save the location, the direction and the path into the record of the character.
+         */
+        void save(CitySnapshot& snapshot, CitySnapshot::Character& record) const;
+
+        /**
+         * @brief Put the handler back in a saved motion.
+         *
+         * The handler must have been constructed on the tile it was moving from.
+         */
+        void restore(
+            const DynamicElementCoordinates& location,
+            const Direction direction,
+            optional<const Tile*> movingTo,
+            QSharedPointer<PathInterface> path,
+            const bool isOnReachedTile
+        );
 
     private:
         /**
-         * @brief Execute the motion.
-         * @return `true` if the location has changed.
+         * @brief Update the target of the slot in the motion store.
+         *
+         * The store expects a target that differs from the current location, so reached tiles are left right away.
          */
-        bool moveToTarget();
+        void updateTarget();
         Direction resolveDirection() const;
 };
 
@@ -0,0 +1,147 @@
+#include "MotionKernel.hpp"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define MOTION_KERNEL_SSE2
+#endif
+
+
+
+void MotionKernel::moveScalar(const Batch& batch)
+{
+    moveFrom(batch, 0);
+}
+
+
+
+void MotionKernel::moveVectorized(const Batch& batch)
+{
+#if defined(__AVX2__)
+    const int LANES(4);
+    const auto zero(_mm256_setzero_pd());
+    int i(0);
+    for (; i + LANES <= batch.count; i += LANES) {
+        auto x(_mm256_loadu_pd(batch.x + i));
+        auto y(_mm256_loadu_pd(batch.y + i));
+        auto speed(_mm256_loadu_pd(batch.speed + i));
+        auto targetX(_mm256_loadu_pd(batch.targetX + i));
+        auto targetY(_mm256_loadu_pd(batch.targetY + i));
+        auto active(_mm256_cmp_pd(speed, zero, _CMP_GT_OQ));
+
+        // Same operations than the scalar kernel: qMin(x + speed, target) or qMax(x - speed, target).
+        auto forwardX(_mm256_and_pd(active, _mm256_cmp_pd(targetX, x, _CMP_GT_OQ)));
+        auto backwardX(_mm256_and_pd(active, _mm256_cmp_pd(targetX, x, _CMP_LT_OQ)));
+        auto forwardY(_mm256_and_pd(active, _mm256_cmp_pd(targetY, y, _CMP_GT_OQ)));
+        auto backwardY(_mm256_and_pd(active, _mm256_cmp_pd(targetY, y, _CMP_LT_OQ)));
+        x = _mm256_blendv_pd(x, _mm256_min_pd(_mm256_add_pd(x, speed), targetX), forwardX);
+        x = _mm256_blendv_pd(x, _mm256_max_pd(_mm256_sub_pd(x, speed), targetX), backwardX);
+        y = _mm256_blendv_pd(y, _mm256_min_pd(_mm256_add_pd(y, speed), targetY), forwardY);
+        y = _mm256_blendv_pd(y, _mm256_max_pd(_mm256_sub_pd(y, speed), targetY), backwardY);
+        _mm256_storeu_pd(batch.x + i, x);
+        _mm256_storeu_pd(batch.y + i, y);
+
+        auto moved(_mm256_or_pd(_mm256_or_pd(forwardX, backwardX), _mm256_or_pd(forwardY, backwardY)));
+        auto arrived(_mm256_and_pd(
+            moved,
+            _mm256_and_pd(_mm256_cmp_pd(x, targetX, _CMP_EQ_OQ), _mm256_cmp_pd(y, targetY, _CMP_EQ_OQ))
+        ));
+        auto movedMask(_mm256_movemask_pd(moved));
+        auto arrivedMask(_mm256_movemask_pd(arrived));
+        for (int lane(0); lane < LANES; ++lane) {
+            batch.moved[i + lane] = (movedMask >> lane) & 1;
+            batch.arrived[i + lane] = (arrivedMask >> lane) & 1;
+        }
+    }
+    moveFrom(batch, i);
+#elif defined(MOTION_KERNEL_SSE2)
+    const int LANES(2);
+    const auto zero(_mm_setzero_pd());
+    int i(0);
+    for (; i + LANES <= batch.count; i += LANES) {
+        auto x(_mm_loadu_pd(batch.x + i));
+        auto y(_mm_loadu_pd(batch.y + i));
+        auto speed(_mm_loadu_pd(batch.speed + i));
+        auto targetX(_mm_loadu_pd(batch.targetX + i));
+        auto targetY(_mm_loadu_pd(batch.targetY + i));
+        auto active(_mm_cmpgt_pd(speed, zero));
+
+        // SSE2 does not provide any blend instruction, the selection is made with bitwise masks.
+        auto forwardX(_mm_and_pd(active, _mm_cmpgt_pd(targetX, x)));
+        auto backwardX(_mm_and_pd(active, _mm_cmplt_pd(targetX, x)));
+        auto forwardY(_mm_and_pd(active, _mm_cmpgt_pd(targetY, y)));
+        auto backwardY(_mm_and_pd(active, _mm_cmplt_pd(targetY, y)));
+        auto movedX(_mm_or_pd(forwardX, backwardX));
+        auto movedY(_mm_or_pd(forwardY, backwardY));
+        auto newX(_mm_or_pd(
+            _mm_and_pd(forwardX, _mm_min_pd(_mm_add_pd(x, speed), targetX)),
+            _mm_and_pd(backwardX, _mm_max_pd(_mm_sub_pd(x, speed), targetX))
+        ));
+        auto newY(_mm_or_pd(
+            _mm_and_pd(forwardY, _mm_min_pd(_mm_add_pd(y, speed), targetY)),
+            _mm_and_pd(backwardY, _mm_max_pd(_mm_sub_pd(y, speed), targetY))
+        ));
+        x = _mm_or_pd(newX, _mm_andnot_pd(movedX, x));
+        y = _mm_or_pd(newY, _mm_andnot_pd(movedY, y));
+        _mm_storeu_pd(batch.x + i, x);
+        _mm_storeu_pd(batch.y + i, y);
+
+        auto moved(_mm_or_pd(movedX, movedY));
+        auto arrived(_mm_and_pd(moved, _mm_and_pd(_mm_cmpeq_pd(x, targetX), _mm_cmpeq_pd(y, targetY))));
+        auto movedMask(_mm_movemask_pd(moved));
+        auto arrivedMask(_mm_movemask_pd(arrived));
+        for (int lane(0); lane < LANES; ++lane) {
+            batch.moved[i + lane] = (movedMask >> lane) & 1;
+            batch.arrived[i + lane] = (arrivedMask >> lane) & 1;
+        }
+    }
+    moveFrom(batch, i);
+#else
+    moveFrom(batch, 0);
+#endif
+}
+
+
+
+const char* MotionKernel::getVectorizationName()
+{
+#if defined(__AVX2__)
+    return "AVX2";
+#elif defined(MOTION_KERNEL_SSE2)
+    return "SSE2";
+#else
+    return "scalar";
+#endif
+}
+
+
+
+void MotionKernel::moveFrom(const Batch& batch, const int from)
+{
+    for (int i(from); i < batch.count; ++i) {
+        auto hasMoved(false);
+        if (batch.speed[i] > 0.0) {
+            if (batch.targetX[i] > batch.x[i]) {
+                batch.x[i] = qMin(batch.x[i] + batch.speed[i], batch.targetX[i]);
+                hasMoved = true;
+            }
+            else if (batch.targetX[i] < batch.x[i]) {
+                batch.x[i] = qMax(batch.x[i] - batch.speed[i], batch.targetX[i]);
+                hasMoved = true;
+            }
+
+            if (batch.targetY[i] > batch.y[i]) {
+                batch.y[i] = qMin(batch.y[i] + batch.speed[i], batch.targetY[i]);
+                hasMoved = true;
+            }
+            else if (batch.targetY[i] < batch.y[i]) {
+                batch.y[i] = qMax(batch.y[i] - batch.speed[i], batch.targetY[i]);
+                hasMoved = true;
+            }
+        }
+
+        batch.moved[i] = hasMoved;
+        batch.arrived[i] = hasMoved && batch.x[i] == batch.targetX[i] && batch.y[i] == batch.targetY[i];
+    }
+}
@@ -0,0 +1,53 @@
+#ifndef MOTIONKERNEL_HPP
+#define MOTIONKERNEL_HPP
+
+#include <QtCore/QtGlobal>
+
+/**
+ * @brief Batch kernels moving many characters at once toward their target.
+ *
+ * For each element of the batch, the location gets closer to the target by at most the speed on each axis, without
+ * ever getting past the target. Elements with a zero speed do not move. The kernels also flag the elements that moved
+ * and the ones that reached their target during this step (and thus need their path to be advanced).
+ *
+ * The vectorized kernel uses AVX2 or SSE2 depending on the instruction sets enabled at compile time, and falls back to
+ * the scalar kernel otherwise. Both kernels apply the exact same floating point operations, so they produce the same
+ * results bit for bit.
+ */
+class MotionKernel
+{
+    public:
+        struct Batch {
+            qreal* x;
+            qreal* y;
+            const qreal* speed;
+            const qreal* targetX;
+            const qreal* targetY;
+            quint8* moved;
+            quint8* arrived;
+            int count;
+        };
+
+        /**
+         * @brief Move the elements of the batch one by one.
+         */
+        static void moveScalar(const Batch& batch);
+
+        /**
+         * @brief Move the elements of the batch using the widest SIMD instruction set available.
+         */
+        static void moveVectorized(const Batch& batch);
+
+        /**
+         * @brief Get the name of the instruction set used by moveVectorized().
+         */
+        static const char* getVectorizationName();
+
+    private:
+        /**
+         * @brief Move the elements of the batch one by one, starting at the given index.
+         */
+        static void moveFrom(const Batch& batch, const int from);
+};
+
+#endif // MOTIONKERNEL_HPP
@@ -0,0 +1,192 @@
+#include "MotionStore.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+#include "src/engine/map/dynamicElement/MotionKernel.hpp"
+#include "src/global/geometry/TileCoordinates.hpp"
+
+
+
+MotionStore::MotionStore() :
+    locationX(),
+    locationY(),
+    previousX(),
+    previousY(),
+    speed(),
+    targetX(),
+    targetY(),
+    direction(),
+    moved(),
+    arrived(),
+    releasedIndexes(),
+    moveCount(0)
+{
+
+}
+
+
+
+int MotionStore::allocate(const DynamicElementCoordinates& location)
+{
+    if (!releasedIndexes.isEmpty()) {
+        auto index(releasedIndexes.takeLast());
+        locationX[index] = location.x();
+        locationY[index] = location.y();
+        previousX[index] = location.x();
+        previousY[index] = location.y();
+        speed[index] = 0.0;
+        targetX[index] = location.x();
+        targetY[index] = location.y();
+        direction[index] = Direction::West;
+        moved[index] = false;
+        arrived[index] = false;
+
+        return index;
+    }
+
+    locationX.append(location.x());
+    locationY.append(location.y());
+    previousX.append(location.x());
+    previousY.append(location.y());
+    speed.append(0.0);
+    targetX.append(location.x());
+    targetY.append(location.y());
+    direction.append(Direction::West);
+    moved.append(false);
+    arrived.append(false);
+
+    return locationX.size() - 1;
+}
+
+
+
+void MotionStore::release(const int index)
+{
+    assert(index >= 0 && index < locationX.size());
+
+    speed[index] = 0.0;
+    targetX[index] = locationX[index];
+    targetY[index] = locationY[index];
+    moved[index] = false;
+    arrived[index] = false;
+    releasedIndexes.append(index);
+}
+
+
+
+void MotionStore::activate(const int index, const qreal speed)
+{
+    this->speed[index] = speed;
+}
+
+
+
+DynamicElementCoordinates MotionStore::getLocation(const int index) const
+{
+    return { locationX.at(index), locationY.at(index) };
+}
+
+
+
+void MotionStore::setLocation(const int index, const DynamicElementCoordinates& location)
+{
+    locationX[index] = location.x();
+    locationY[index] = location.y();
+}
+
+
+
+Direction MotionStore::getDirection(const int index) const
+{
+    return direction.at(index);
+}
+
+
+
+void MotionStore::setDirection(const int index, Direction direction)
+{
+    this->direction[index] = direction;
+}
+
+
+
+void MotionStore::setTarget(const int index, const TileCoordinates& target)
+{
+    targetX[index] = target.x();
+    targetY[index] = target.y();
+}
+
+
+
+void MotionStore::clearTarget(const int index)
+{
+    targetX[index] = locationX.at(index);
+    targetY[index] = locationY.at(index);
+}
+
+
+
+bool MotionStore::hasMoved(const int index) const
+{
+    return moved.at(index);
+}
+
+
+
+bool MotionStore::hasArrived(const int index) const
+{
+    return arrived.at(index);
+}
+
+
+
+quint32 MotionStore::getMoveCount() const
+{
+    return moveCount;
+}
+
+
+
+void MotionStore::cancelStep(const int index)
+{
+    locationX[index] = previousX.at(index);
+    locationY[index] = previousY.at(index);
+    moved[index] = false;
+    arrived[index] = false;
+}
+
+
+
+void MotionStore::step(const int index)
+{
+    MotionKernel::moveScalar({
+        locationX.data() + index,
+        locationY.data() + index,
+        speed.constData() + index,
+        targetX.constData() + index,
+        targetY.constData() + index,
+        moved.data() + index,
+        arrived.data() + index,
+        1
+    });
+}
+
+
+
+void MotionStore::moveAll()
+{
+    std::copy(locationX.constBegin(), locationX.constEnd(), previousX.begin());
+    std::copy(locationY.constBegin(), locationY.constEnd(), previousY.begin());
+    ++moveCount;
+    MotionKernel::moveVectorized({
+        locationX.data(),
+        locationY.data(),
+        speed.constData(),
+        targetX.constData(),
+        targetY.constData(),
+        moved.data(),
+        arrived.data(),
+        locationX.size()
+    });
+}
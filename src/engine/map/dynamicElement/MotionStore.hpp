@@ -0,0 +1,91 @@
+#ifndef MOTIONSTORE_HPP
+#define MOTIONSTORE_HPP
+
+#include <QtCore/QVector>
+
+#include "src/global/geometry/DynamicElementCoordinates.hpp"
+#include "src/global/Direction.hpp"
+
+class TileCoordinates;
+
+/**
+ * @brief The motion state of all the characters of the map, stored as a structure of arrays.
+ *
+ * Each character's motion handler owns a slot in the store, referenced by its index. The location, the speed, the
+ * coordinates of the tile the character is moving to and its direction are stored in separate contiguous arrays, so
+ * that the motion of all the characters can be processed in a single pass (see moveAll()).
+ *
+ * Released slots are recycled, so indexes are stable for the whole lifetime of a motion handler. A slot does not move
+ * until it is activated: the characters waiting for registration must not move before being processed. The last step
+ * of a slot can be cancelled, so that a character changing its target before following its motion steps towards the
+ * new target instead (see MotionHandler::takePath()).
+ */
+class MotionStore
+{
+        Q_DISABLE_COPY_MOVE(MotionStore)
+
+    private:
+        QVector<qreal> locationX;
+        QVector<qreal> locationY;
+        QVector<qreal> previousX;///< The location of each slot before the last call to moveAll().
+        QVector<qreal> previousY;
+        QVector<qreal> speed;///< The speed of each slot, zero for inactive slots.
+        QVector<qreal> targetX;
+        QVector<qreal> targetY;
+        QVector<Direction> direction;
+        QVector<quint8> moved;///< Indicate if the slot moved during the last call to moveAll().
+        QVector<quint8> arrived;///< Indicate if the slot reached its target during the last call to moveAll().
+        QVector<int> releasedIndexes;
+        quint32 moveCount;///< The number of calls to moveAll().
+
+    public:
+        MotionStore();
+
+        /**
+         * @brief Allocate an inactive slot at the given location.
+         *
+         * @return The index of the slot.
+         */
+        int allocate(const DynamicElementCoordinates& location);
+        void release(const int index);
+        void activate(const int index, const qreal speed);
+
+        DynamicElementCoordinates getLocation(const int index) const;
+        void setLocation(const int index, const DynamicElementCoordinates& location);
+        Direction getDirection(const int index) const;
+        void setDirection(const int index, Direction direction);
+
+        /**
+         * @brief Set the coordinates the slot is moving to.
+         */
+        void setTarget(const int index, const TileCoordinates& target);
+
+        /**
+         * @brief Stop the motion of the slot, by setting its target to its current location.
+         */
+        void clearTarget(const int index);
+
+        bool hasMoved(const int index) const;
+        bool hasArrived(const int index) const;
+        quint32 getMoveCount() const;
+
+        /**
+         * @brief Put the slot back where it was before the last call to moveAll().
+         */
+        void cancelStep(const int index);
+
+        /**
+         * @brief Move the slot one step towards its target, exactly as moveAll() does.
+         */
+        void step(const int index);
+
+        /**
+         * @brief Move all the active slots one step towards their target.
+         *
+         * The location of each slot gets closer to its target by at most its speed on each axis, without ever getting
+         * past the target. The arrays are processed by the vectorized motion kernel (see MotionKernel).
+         */
+        void moveAll();
+};
+
+#endif // MOTIONSTORE_HPP
@@ -2,23 +2,31 @@
 
 #include "src/engine/map/dynamicElement/MotionHandler.hpp"
 #include "src/engine/map/staticElement/building/AbstractProcessableBuilding.hpp"
+#include "src/engine/StateJournal.hpp"
 #include "src/global/conf/CharacterInformation.hpp"
 #include "src/global/state/CharacterState.hpp"
 
 
 
 Character::Character(
+    const Kind kind,
     CharacterDisposerInterface& characterManager,
     const PathGeneratorInterface& pathGenerator,
+    const BuildingResolverInterface& buildingResolver,
+    MotionStore& motionStore,
     const CharacterInformation& conf,
-    const QSharedPointer<AbstractProcessableBuilding>& issuer
+    const AbstractProcessableBuilding& issuer
 ) :
     AbstractProcessable(),
+    kind(kind),
+    stateJournal(nullptr),
     characterManager(characterManager),
     pathGenerator(pathGenerator),
+    buildingResolver(buildingResolver),
     conf(conf),
-    motionHandler(conf.getSpeed(), issuer->getEntryPointTile()),
-    issuer(issuer),
+    motionHandler(motionStore, conf.getSpeed(), issuer.getEntryPointTile()),
+    handle(),
+    issuer(issuer.getHandle()),
     stateVersion(0)
 {
 
@@ -26,6 +34,45 @@ Character::Character(
 
 
 
+Character::Character(
+    const Kind kind,
+    CharacterDisposerInterface& characterManager,
+    const PathGeneratorInterface& pathGenerator,
+    const BuildingResolverInterface& buildingResolver,
+    MotionStore& motionStore,
+    const CharacterInformation& conf,
+    const Restoration& restoration
+) :
+    AbstractProcessable(),
+    kind(kind),
+    stateJournal(nullptr),
+    characterManager(characterManager),
+    pathGenerator(pathGenerator),
+    buildingResolver(buildingResolver),
+    conf(conf),
+    motionHandler(motionStore, conf.getSpeed(), restoration.movingFrom),
+    handle(),
+    issuer(BuildingHandle::unpack(restoration.record.issuer)),
+    stateVersion(0)
+{
+    motionHandler.restore(
+        { restoration.record.x, restoration.record.y },
+        static_cast<Direction>(restoration.record.direction),
+        restoration.movingTo,
+        restoration.path,
+        restoration.record.flags & CitySnapshot::Character::OnReachedTile
+    );
+}
+
+
+
+Character::Kind Character::getKind() const
+{
+    return kind;
+}
+
+
+
 bool Character::isOfType(const CharacterInformation& conf) const
 {
     return &conf == &this->conf;
@@ -33,17 +80,38 @@ bool Character::isOfType(const CharacterInformation& conf) const
 
 
 
-const QWeakPointer<AbstractProcessableBuilding>& Character::getIssuer() const
+const BuildingHandle& Character::getIssuer() const
 {
     return issuer;
 }
 
 
 
+const CharacterHandle& Character::getHandle() const
+{
+    return handle;
+}
+
+
+
+void Character::setHandle(const CharacterHandle& handle)
+{
+    this->handle = handle;
+}
+
+
+
+void Character::setStateJournal(optional<StateJournal*> stateJournal)
+{
+    this->stateJournal = stateJournal;
+}
+
+
+
 CharacterState Character::getCurrentState() const
 {
     return {
-        reinterpret_cast<qintptr>(this),
+        handle.pack(),
         conf,
         motionHandler.getCurrentLocation(),
         motionHandler.getCurrentDirection(),
@@ -54,18 +122,39 @@ CharacterState Character::getCurrentState() const
 
 
 
+void Character::activateMotion()
+{
+    motionHandler.activate();
+}
+
+
+
 void Character::process(const CycleDate& /*date*/)
 {
-    if (motionHandler.move()) {
+    if (motionHandler.updateMotion()) {
         notifyViewDataChange();
     }
 }
 
 
 
+void Character::save(CitySnapshot& snapshot, CitySnapshot::Character& record) const
+{
+    record.handle = handle.pack();
+    record.issuer = issuer.pack();
+    record.conf = CitySnapshot::indexKey(snapshot.characterKeys, conf.getKey());
+    record.kind = static_cast<qint32>(kind);
+    motionHandler.save(snapshot, record);
+}
+
+
+
 void Character::notifyViewDataChange()
 {
     ++stateVersion;
+    if (stateJournal) {
+        stateJournal->notifyCharacterChange(*this);
+    }
 }
 
 
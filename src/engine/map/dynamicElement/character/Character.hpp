@@ -1,7 +1,10 @@
 #ifndef CHARACTER_HPP
 #define CHARACTER_HPP
 
+#include "src/engine/loader/CitySnapshot.hpp"
+#include "src/engine/map/dynamicElement/CharacterGeneratorInterface.hpp"
 #include "src/engine/map/dynamicElement/MotionHandler.hpp"
+#include "src/engine/map/staticElement/building/BuildingResolverInterface.hpp"
 #include "src/engine/processing/AbstractProcessable.hpp"
 #include "src/global/CharacterStatus.hpp"
 #include "src/defines.hpp"
@@ -10,7 +13,11 @@ class AbstractProcessableBuilding;
 class CharacterInformation;
 class CharacterDisposerInterface;
 class MapCoordinates;
+class MotionStore;
 class PathGeneratorInterface;
+class PathInterface;
+class StateJournal;
+class Tile;
 struct CharacterState;
 
 /**
@@ -22,39 +29,133 @@ struct CharacterState;
  *
  * Characters are always issued from a building. This building (the `issuer`) does not strictly own the character:
  * all the characters belong to the map. Furthermore, a charater can be kept alive even if the issuer has been
- * destroyed.
+ * destroyed. That is why characters only keep handles to buildings, resolved through the building resolver each time
+ * they need to interact with them.
  *
  * If a character is granted wandering credits, it will use them to wander around (see MotionHandler for more details).
  * Otherwise, the character won't move until a target is assigned to it.
+ *
+ * Each concrete character class has its own kind, so that buildings can identify the characters visiting them without
+ * RTTI (see castTo()).
  */
 class Character : public AbstractProcessable
 {
+    public:
+        /**
+         * @brief The closed set of character kinds.
+         */
+        enum class Kind {
+            DeliveryMan,
+            Immigrant,
+            Miner,
+            Student,
+            Wandering,
+        };
+
+        /**
+         * @brief The saved state of a character, with its tiles and path already resolved on the map.
+         */
+        struct Restoration {
+            const CitySnapshot::Character& record;
+            const Tile& movingFrom;
+            optional<const Tile*> movingTo;
+            QSharedPointer<PathInterface> path;
+        };
+
+    private:
+        const Kind kind; ///< The kind of the concrete character class.
+        optional<StateJournal*> stateJournal; ///< The journal to notify about the changes of the character, if any.
+
     protected:
         CharacterDisposerInterface& characterManager; ///< A service for requiring the character destruction.
         const PathGeneratorInterface& pathGenerator; ///< A service for generating paths.
+        const BuildingResolverInterface& buildingResolver; ///< A service for resolving the building handles.
         const CharacterInformation& conf; ///< The character configuration.
         MotionHandler motionHandler; ///< A helper that will handle the character's motion.
-        QWeakPointer<AbstractProcessableBuilding> issuer; ///< The issuer building.
+        CharacterHandle handle; ///< The handle referencing the character in the registry.
+        BuildingHandle issuer; ///< The issuer building.
         int stateVersion; ///< We use an int for the versionning of the view. Note that an overflow is not dramatic since we always compare versions using equality.
 
     public:
         Character(
+            const Kind kind,
+            CharacterDisposerInterface& characterManager,
+            const PathGeneratorInterface& pathGenerator,
+            const BuildingResolverInterface& buildingResolver,
+            MotionStore& motionStore,
+            const CharacterInformation& conf,
+            const AbstractProcessableBuilding& issuer
+        );
+
+        /**
+         * @brief Restore a saved character.
+         *
+         * The issuer may not exist anymore, so it is only known by its handle.
+         */
+        Character(
+            const Kind kind,
             CharacterDisposerInterface& characterManager,
             const PathGeneratorInterface& pathGenerator,
+            const BuildingResolverInterface& buildingResolver,
+            MotionStore& motionStore,
             const CharacterInformation& conf,
-            const QSharedPointer<AbstractProcessableBuilding>& issuer
+            const Restoration& restoration
         );
 
+        Kind getKind() const;
         bool isOfType(const CharacterInformation& conf) const;
-        const QWeakPointer<AbstractProcessableBuilding>& getIssuer() const;
+
+        /**
+         * @brief Get the character as an instance of the given character class, or nullptr if it is of another kind.
+         *
+         * The character class must declare its kind in a `KIND` constant.
+         */
+        template<class CharacterClass>
+        optional<CharacterClass*> castTo()
+        {
+            return kind == CharacterClass::KIND ? static_cast<CharacterClass*>(this) : nullptr;
+        }
+
+        const BuildingHandle& getIssuer() const;
+        const CharacterHandle& getHandle() const;
+
+        /**
+         * @brief Set the handle referencing the character in its registry.
+         *
+         * Must be called once by the registry owning the character.
+         */
+        void setHandle(const CharacterHandle& handle);
+
+        /**
+         * @brief Set the journal to notify about the changes of the character.
+         *
+         * The journal must outlive the character.
+         */
+        void setStateJournal(optional<StateJournal*> stateJournal);
 
         CharacterState getCurrentState() const;
 
         /**
-         * @brief Make the charater move.
+         * @brief Let the character move with the other characters of the map.
+         *
+         * Must be called once the character has been registered.
+         */
+        void activateMotion();
+
+        /**
+         * @brief Make the charater follow its path.
+         *
+         * The motion itself has already been processed for all the characters by the motion store.
          */
         virtual void process(const CycleDate& date) override;
 
+        /**
+         * @brief Save the character into the record.
+         *
+         * Each kind of character completes the record with its own state.
+         */
+        virtual void save(CitySnapshot& snapshot, CitySnapshot::Character& record) const;
+
     protected:
         void notifyViewDataChange();
 
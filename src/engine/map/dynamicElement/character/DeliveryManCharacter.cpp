@@ -7,19 +7,22 @@
 #include "src/engine/map/staticElement/building/AbstractProcessableBuilding.hpp"
 #include "src/engine/map/staticElement/building/BuildingSearchEngine.hpp"
 #include "src/engine/map/staticElement/building/StorageBuilding.hpp"
+#include "src/global/conf/ItemInformation.hpp"
 
 
 
 DeliveryManCharacter::DeliveryManCharacter(
     CharacterDisposerInterface& characterManager,
     const PathGeneratorInterface& pathGenerator,
+    const BuildingResolverInterface& buildingResolver,
+    MotionStore& motionStore,
     const BuildingSearchEngine& searchEngine,
     const CharacterInformation& conf,
-    const QSharedPointer<AbstractProcessableBuilding>& issuer,
+    const AbstractProcessableBuilding& issuer,
     const ItemInformation& transportedItemConf,
     const int transportedQuantity
 ) :
-    Character(characterManager, pathGenerator, conf, issuer),
+    Character(KIND, characterManager, pathGenerator, buildingResolver, motionStore, conf, issuer),
     searchEngine(searchEngine),
     target(),
     transportedItemConf(transportedItemConf),
@@ -31,6 +34,28 @@ DeliveryManCharacter::DeliveryManCharacter(
 
 
 
+DeliveryManCharacter::DeliveryManCharacter(
+    CharacterDisposerInterface& characterManager,
+    const PathGeneratorInterface& pathGenerator,
+    const BuildingResolverInterface& buildingResolver,
+    MotionStore& motionStore,
+    const BuildingSearchEngine& searchEngine,
+    const CharacterInformation& conf,
+    const ItemInformation& transportedItemConf,
+    const Restoration& restoration
+) :
+    Character(KIND, characterManager, pathGenerator, buildingResolver, motionStore, conf, restoration),
+    searchEngine(searchEngine),
+    target(BuildingHandle::unpack(restoration.record.target)),
+    transportedItemConf(transportedItemConf),
+    transportedQuantity(restoration.record.quantity),
+    goingHome(restoration.record.flags & CitySnapshot::Character::GoingHome)
+{
+
+}
+
+
+
 const ItemInformation& DeliveryManCharacter::getTransportedItemConf() const
 {
     return transportedItemConf;
@@ -63,7 +88,7 @@ void DeliveryManCharacter::unload(const int quantity)
 
 void DeliveryManCharacter::goHome()
 {
-    auto issuer(this->issuer.toStrongRef());
+    auto issuer(buildingResolver.resolveBuilding(this->issuer));
     if (issuer) {
         goingHome = true;
         motionHandler.takePath(pathGenerator.generateShortestRoadPathTo(
@@ -75,12 +100,25 @@ void DeliveryManCharacter::goHome()
 
 
 
+void DeliveryManCharacter::save(CitySnapshot& snapshot, CitySnapshot::Character& record) const
+{
+    Character::save(snapshot, record);
+    record.target = target.pack();
+    record.item = snapshot.itemKeys.indexOf(transportedItemConf.getKey());
+    record.quantity = transportedQuantity;
+    if (goingHome) {
+        record.flags |= CitySnapshot::Character::GoingHome;
+    }
+}
+
+
+
 void DeliveryManCharacter::process(const CycleDate& date)
 {
-    if (target.isNull()) {
+    if (!buildingResolver.resolveBuilding(target)) {
         auto storage(searchEngine.findClosestStorageThatCanStore(transportedItemConf, motionHandler.getCurrentTile()));
         if (storage) {
-            target = storage;
+            target = storage->getHandle();
             motionHandler.takePath(pathGenerator.generateShortestRoadPathTo(
                 motionHandler.getCurrentTile(),
                 storage->getEntryPointTile()
@@ -92,7 +130,7 @@ void DeliveryManCharacter::process(const CycleDate& date)
 
     if (motionHandler.isPathCompleted()) {
         if (goingHome) {
-            auto issuer(this->issuer.toStrongRef());
+            auto issuer(buildingResolver.resolveBuilding(this->issuer));
             if (issuer) {
                 issuer->processInteraction(date, *this);
             }
@@ -104,7 +142,7 @@ void DeliveryManCharacter::process(const CycleDate& date)
             }
         }
         else {
-            auto target(this->target.toStrongRef());
+            auto target(buildingResolver.resolveBuilding(this->target));
             if (target) {
                 target->processInteraction(date, *this);
                 notifyViewDataChange();
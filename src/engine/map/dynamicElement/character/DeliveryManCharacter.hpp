@@ -11,22 +11,41 @@ class DeliveryManCharacter : public Character
 {
     private:
         const BuildingSearchEngine& searchEngine;
-        QWeakPointer<AbstractProcessableBuilding> target;
+        BuildingHandle target;
         const ItemInformation& transportedItemConf;
         int transportedQuantity;
         bool goingHome;
 
+    public:
+        static constexpr Kind KIND = Kind::DeliveryMan;
+
     public:
         DeliveryManCharacter(
             CharacterDisposerInterface& characterManager,
             const PathGeneratorInterface& pathGenerator,
+            const BuildingResolverInterface& buildingResolver,
+            MotionStore& motionStore,
             const BuildingSearchEngine& searchEngine,
             const CharacterInformation& conf,
-            const QSharedPointer<AbstractProcessableBuilding>& issuer,
+            const AbstractProcessableBuilding& issuer,
             const ItemInformation& transportedItemConf,
             const int transportedQuantity = 0
         );
 
+        /**
+         * @brief Restore a saved delivery man.
+         */
+        DeliveryManCharacter(
+            CharacterDisposerInterface& characterManager,
+            const PathGeneratorInterface& pathGenerator,
+            const BuildingResolverInterface& buildingResolver,
+            MotionStore& motionStore,
+            const BuildingSearchEngine& searchEngine,
+            const CharacterInformation& conf,
+            const ItemInformation& transportedItemConf,
+            const Restoration& restoration
+        );
+
         const ItemInformation& getTransportedItemConf() const;
 
         bool isEmpty() const;
@@ -38,6 +57,8 @@ class DeliveryManCharacter : public Character
         void goHome();
 
         virtual void process(const CycleDate& date) override;
+
+        virtual void save(CitySnapshot& snapshot, CitySnapshot::Character& record) const override;
 };
 
 #endif // DELIVERYMANCHARACTER_HPP
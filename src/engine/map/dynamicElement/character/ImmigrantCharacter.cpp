@@ -9,14 +9,40 @@
 ImmigrantCharacter::ImmigrantCharacter(
     CharacterDisposerInterface& characterManager,
     const PathGeneratorInterface& pathGenerator,
+    const BuildingResolverInterface& buildingResolver,
+    MotionStore& motionStore,
     const CharacterInformation& conf,
-    const QSharedPointer<AbstractProcessableBuilding>& issuer,
-    const QSharedPointer<AbstractProcessableBuilding>& target
+    const AbstractProcessableBuilding& issuer,
+    const AbstractProcessableBuilding& target
 ) :
-    Character(characterManager, pathGenerator, conf, issuer),
-    target(target)
+    Character(KIND, characterManager, pathGenerator, buildingResolver, motionStore, conf, issuer),
+    target(target.getHandle())
 {
-    motionHandler.takePath(pathGenerator.generateShortestPathTo(issuer->getEntryPointTile(), target->getEntryPointTile()));
+    motionHandler.takePath(pathGenerator.generateShortestPathTo(issuer.getEntryPointTile(), target.getEntryPointTile()));
+}
+
+
+
+ImmigrantCharacter::ImmigrantCharacter(
+    CharacterDisposerInterface& characterManager,
+    const PathGeneratorInterface& pathGenerator,
+    const BuildingResolverInterface& buildingResolver,
+    MotionStore& motionStore,
+    const CharacterInformation& conf,
+    const Restoration& restoration
+) :
+    Character(KIND, characterManager, pathGenerator, buildingResolver, motionStore, conf, restoration),
+    target(BuildingHandle::unpack(restoration.record.target))
+{
+
+}
+
+
+
+void ImmigrantCharacter::save(CitySnapshot& snapshot, CitySnapshot::Character& record) const
+{
+    Character::save(snapshot, record);
+    record.target = target.pack();
 }
 
 
@@ -26,7 +52,7 @@ void ImmigrantCharacter::process(const CycleDate& date)
     Character::process(date);
 
     if (motionHandler.isPathCompleted()) {
-        auto target(this->target.toStrongRef());
+        auto target(buildingResolver.resolveBuilding(this->target));
         if (target) {
             target->processInteraction(date, *this);
         }
@@ -8,18 +8,37 @@ class AbstractProcessableBuilding;
 class ImmigrantCharacter : public Character
 {
     private:
-        QWeakPointer<AbstractProcessableBuilding> target;
+        BuildingHandle target;
+
+    public:
+        static constexpr Kind KIND = Kind::Immigrant;
 
     public:
         ImmigrantCharacter(
             CharacterDisposerInterface& characterManager,
             const PathGeneratorInterface& pathGenerator,
+            const BuildingResolverInterface& buildingResolver,
+            MotionStore& motionStore,
             const CharacterInformation& conf,
-            const QSharedPointer<AbstractProcessableBuilding>& issuer,
-            const QSharedPointer<AbstractProcessableBuilding>& target
+            const AbstractProcessableBuilding& issuer,
+            const AbstractProcessableBuilding& target
+        );
+
+        /**
+         * @brief Restore a saved immigrant.
+         */
+        ImmigrantCharacter(
+            CharacterDisposerInterface& characterManager,
+            const PathGeneratorInterface& pathGenerator,
+            const BuildingResolverInterface& buildingResolver,
+            MotionStore& motionStore,
+            const CharacterInformation& conf,
+            const Restoration& restoration
         );
 
         virtual void process(const CycleDate& date) override;
+
+        virtual void save(CitySnapshot& snapshot, CitySnapshot::Character& record) const override;
 };
 
 #endif // IMMIGRANTCHARACTER_HPP
@@ -1,13 +1,12 @@
 #include "MinerCharacter.hpp"
 
-#include <cassert>
-
 #include "src/engine/map/dynamicElement/CharacterDisposerInterface.hpp"
 #include "src/engine/map/path/PathGenerator.hpp"
 #include "src/engine/map/staticElement/building/AbstractProcessableBuilding.hpp"
 #include "src/engine/map/staticElement/natureElement/NatureElement.hpp"
 #include "src/engine/map/staticElement/natureElement/NatureElementSearchEngine.hpp"
 #include "src/exceptions/NotImplementedException.hpp"
+#include "src/exceptions/UnexpectedException.hpp"
 #include "src/global/conf/CharacterInformation.hpp"
 
 
@@ -15,12 +14,14 @@
 MinerCharacter::MinerCharacter(
     CharacterDisposerInterface& characterManager,
     const PathGeneratorInterface& pathGenerator,
+    const BuildingResolverInterface& buildingResolver,
+    MotionStore& motionStore,
     const NatureElementSearchEngine& searchEngine,
     const CharacterInformation& conf,
-    const QSharedPointer<AbstractProcessableBuilding>& issuer,
+    const AbstractProcessableBuilding& issuer,
     QSharedPointer<PathInterface> path
 ) :
-    Character(characterManager, pathGenerator, conf, issuer),
+    Character(KIND, characterManager, pathGenerator, buildingResolver, motionStore, conf, issuer),
     searchEngine(searchEngine),
     goingHome(false),
     workingCountDown(conf.getActionInterval()),
@@ -31,9 +32,29 @@ MinerCharacter::MinerCharacter(
 
 
 
+MinerCharacter::MinerCharacter(
+    CharacterDisposerInterface& characterManager,
+    const PathGeneratorInterface& pathGenerator,
+    const BuildingResolverInterface& buildingResolver,
+    MotionStore& motionStore,
+    const NatureElementSearchEngine& searchEngine,
+    const CharacterInformation& conf,
+    const Restoration& restoration
+) :
+    Character(KIND, characterManager, pathGenerator, buildingResolver, motionStore, conf, restoration),
+    searchEngine(searchEngine),
+    goingHome(restoration.record.flags & CitySnapshot::Character::GoingHome),
+    workingCountDown(restoration.record.countDown),
+    status(static_cast<CharacterStatus>(restoration.record.status))
+{
+
+}
+
+
+
 void MinerCharacter::goHome()
 {
-    auto issuer(this->issuer.toStrongRef());
+    auto issuer(buildingResolver.resolveBuilding(this->issuer));
     if (issuer) {
         goingHome = true;
         motionHandler.takePath(pathGenerator.generateShortestPathTo(
@@ -45,13 +66,25 @@ void MinerCharacter::goHome()
 
 
 
+void MinerCharacter::save(CitySnapshot& snapshot, CitySnapshot::Character& record) const
+{
+    Character::save(snapshot, record);
+    if (goingHome) {
+        record.flags |= CitySnapshot::Character::GoingHome;
+    }
+    record.countDown = workingCountDown;
+    record.status = static_cast<qint32>(status);
+}
+
+
+
 void MinerCharacter::process(const CycleDate& date)
 {
     Character::process(date);
 
     if (motionHandler.isPathCompleted()) {
         if (goingHome) {
-            auto issuer(this->issuer.toStrongRef());
+            auto issuer(buildingResolver.resolveBuilding(this->issuer));
             if (issuer) {
                 issuer->processInteraction(date, *this);
             }
@@ -65,8 +98,10 @@ void MinerCharacter::process(const CycleDate& date)
                     // TODO: Target has been destroyed, find another target.
                     throw NotImplementedException("Handling destroyed natural resource");
                 }
-                auto naturalResource(target.dynamicCast<NatureElement>());
-                assert(!naturalResource.isNull());
+                auto naturalResource(target->castTo<NatureElement>());
+                if (!naturalResource) {
+                    throw UnexpectedException("A miner must target a natural resource.");
+                }
                 if (naturalResource->isBusy()) {
                     auto path(searchEngine.getPathToClosestNaturalResource(
                         naturalResource->getConf(),
@@ -91,8 +126,10 @@ void MinerCharacter::process(const CycleDate& date)
                 auto target(motionHandler.target().toStrongRef());
                 if (!target.isNull()) {
                     // For now, we ignore if the target has been destroyed.
-                    auto naturalResource(target.dynamicCast<NatureElement>());
-                    assert(!naturalResource.isNull());
+                    auto naturalResource(target->castTo<NatureElement>());
+                    if (!naturalResource) {
+                        throw UnexpectedException("A miner must target a natural resource.");
+                    }
                     naturalResource->endInteraction();
                 }
                 workingCountDown = conf.getActionInterval();
@@ -7,20 +7,40 @@ class NatureElementSearchEngine;
 
 class MinerCharacter : public Character
 {
+    public:
+        static constexpr Kind KIND = Kind::Miner;
+
     public:
         MinerCharacter(
             CharacterDisposerInterface& characterManager,
             const PathGeneratorInterface& pathGenerator,
+            const BuildingResolverInterface& buildingResolver,
+            MotionStore& motionStore,
             const NatureElementSearchEngine& searchEngine,
             const CharacterInformation& conf,
-            const QSharedPointer<AbstractProcessableBuilding>& issuer,
+            const AbstractProcessableBuilding& issuer,
             QSharedPointer<PathInterface> path
         );
 
+        /**
+         * @brief Restore a saved miner.
+         */
+        MinerCharacter(
+            CharacterDisposerInterface& characterManager,
+            const PathGeneratorInterface& pathGenerator,
+            const BuildingResolverInterface& buildingResolver,
+            MotionStore& motionStore,
+            const NatureElementSearchEngine& searchEngine,
+            const CharacterInformation& conf,
+            const Restoration& restoration
+        );
+
         void goHome();
 
         virtual void process(const CycleDate& date) override;
 
+        virtual void save(CitySnapshot& snapshot, CitySnapshot::Character& record) const override;
+
     protected:
         virtual CharacterStatus getCurrentStatus() const override;
 
@@ -8,25 +8,51 @@
 StudentCharacter::StudentCharacter(
     CharacterDisposerInterface& characterManager,
     const PathGeneratorInterface& pathGenerator,
+    const BuildingResolverInterface& buildingResolver,
+    MotionStore& motionStore,
     const CharacterInformation& conf,
-    const QSharedPointer<AbstractProcessableBuilding>& issuer,
-    const QWeakPointer<AbstractProcessableBuilding>& target,
+    const AbstractProcessableBuilding& issuer,
+    const AbstractProcessableBuilding& target,
     QSharedPointer<PathInterface> path
 ) :
-    Character(characterManager, pathGenerator, conf, issuer),
-    target(target)
+    Character(KIND, characterManager, pathGenerator, buildingResolver, motionStore, conf, issuer),
+    target(target.getHandle())
 {
     motionHandler.takePath(path);
 }
 
 
 
+StudentCharacter::StudentCharacter(
+    CharacterDisposerInterface& characterManager,
+    const PathGeneratorInterface& pathGenerator,
+    const BuildingResolverInterface& buildingResolver,
+    MotionStore& motionStore,
+    const CharacterInformation& conf,
+    const Restoration& restoration
+) :
+    Character(KIND, characterManager, pathGenerator, buildingResolver, motionStore, conf, restoration),
+    target(BuildingHandle::unpack(restoration.record.target))
+{
+
+}
+
+
+
+void StudentCharacter::save(CitySnapshot& snapshot, CitySnapshot::Character& record) const
+{
+    Character::save(snapshot, record);
+    record.target = target.pack();
+}
+
+
+
 void StudentCharacter::process(const CycleDate& date)
 {
     Character::process(date);
 
     if (motionHandler.isPathCompleted()) {
-        auto target(this->target.toStrongRef());
+        auto target(buildingResolver.resolveBuilding(this->target));
         if (target) {
             target->processInteraction(date, *this);
         }
@@ -8,19 +8,38 @@ class AbstractProcessableBuilding;
 class StudentCharacter : public Character
 {
     private:
-        QWeakPointer<AbstractProcessableBuilding> target;
+        BuildingHandle target;
+
+    public:
+        static constexpr Kind KIND = Kind::Student;
 
     public:
         StudentCharacter(
             CharacterDisposerInterface& characterManager,
             const PathGeneratorInterface& pathGenerator,
+            const BuildingResolverInterface& buildingResolver,
+            MotionStore& motionStore,
             const CharacterInformation& conf,
-            const QSharedPointer<AbstractProcessableBuilding>& issuer,
-            const QWeakPointer<AbstractProcessableBuilding>& target,
+            const AbstractProcessableBuilding& issuer,
+            const AbstractProcessableBuilding& target,
             QSharedPointer<PathInterface> path
         );
 
+        /**
+         * @brief Restore a saved student.
+         */
+        StudentCharacter(
+            CharacterDisposerInterface& characterManager,
+            const PathGeneratorInterface& pathGenerator,
+            const BuildingResolverInterface& buildingResolver,
+            MotionStore& motionStore,
+            const CharacterInformation& conf,
+            const Restoration& restoration
+        );
+
         virtual void process(const CycleDate& date) override;
+
+        virtual void save(CitySnapshot& snapshot, CitySnapshot::Character& record) const override;
 };
 
 #endif // STUDENTCHARACTER_HPP
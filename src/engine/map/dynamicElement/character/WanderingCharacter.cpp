@@ -10,20 +10,38 @@
 WanderingCharacter::WanderingCharacter(
     CharacterDisposerInterface& characterManager,
     const PathGeneratorInterface& pathGenerator,
+    const BuildingResolverInterface& buildingResolver,
+    MotionStore& motionStore,
     const CharacterInformation& conf,
-    const QSharedPointer<AbstractProcessableBuilding>& issuer
+    const AbstractProcessableBuilding& issuer
 ) :
-    Character(characterManager, pathGenerator, conf, issuer),
+    Character(KIND, characterManager, pathGenerator, buildingResolver, motionStore, conf, issuer),
     goingHome(false)
 {
-    motionHandler.takePath(pathGenerator.generateWanderingPath(issuer->getEntryPointTile(), conf.getWanderingCredits()));
+    motionHandler.takePath(pathGenerator.generateWanderingPath(issuer.getEntryPointTile(), conf.getWanderingCredits()));
+}
+
+
+
+WanderingCharacter::WanderingCharacter(
+    CharacterDisposerInterface& characterManager,
+    const PathGeneratorInterface& pathGenerator,
+    const BuildingResolverInterface& buildingResolver,
+    MotionStore& motionStore,
+    const CharacterInformation& conf,
+    const Restoration& restoration
+) :
+    Character(KIND, characterManager, pathGenerator, buildingResolver, motionStore, conf, restoration),
+    goingHome(restoration.record.flags & CitySnapshot::Character::GoingHome)
+{
+
 }
 
 
 
 void WanderingCharacter::goHome()
 {
-    auto issuer(this->issuer.toStrongRef());
+    auto issuer(buildingResolver.resolveBuilding(this->issuer));
     if (issuer) {
         goingHome = true;
         motionHandler.takePath(pathGenerator.generateShortestRoadPathTo(
@@ -35,13 +53,23 @@ void WanderingCharacter::goHome()
 
 
 
+void WanderingCharacter::save(CitySnapshot& snapshot, CitySnapshot::Character& record) const
+{
+    Character::save(snapshot, record);
+    if (goingHome) {
+        record.flags |= CitySnapshot::Character::GoingHome;
+    }
+}
+
+
+
 void WanderingCharacter::process(const CycleDate& date)
 {
     Character::process(date);
 
     if (motionHandler.isPathCompleted()) {
         if (goingHome) {
-            auto issuer(this->issuer.toStrongRef());
+            auto issuer(buildingResolver.resolveBuilding(this->issuer));
             if (issuer) {
                 issuer->processInteraction(date, *this);
             }
@@ -8,17 +8,36 @@ class WanderingCharacter : public Character
     private:
         bool goingHome;
 
+    public:
+        static constexpr Kind KIND = Kind::Wandering;
+
     public:
         WanderingCharacter(
             CharacterDisposerInterface& characterManager,
             const PathGeneratorInterface& pathGenerator,
+            const BuildingResolverInterface& buildingResolver,
+            MotionStore& motionStore,
             const CharacterInformation& conf,
-            const QSharedPointer<AbstractProcessableBuilding>& issuer
+            const AbstractProcessableBuilding& issuer
+        );
+
+        /**
+         * @brief Restore a saved wandering.
+         */
+        WanderingCharacter(
+            CharacterDisposerInterface& characterManager,
+            const PathGeneratorInterface& pathGenerator,
+            const BuildingResolverInterface& buildingResolver,
+            MotionStore& motionStore,
+            const CharacterInformation& conf,
+            const Restoration& restoration
         );
 
         void goHome();
 
         virtual void process(const CycleDate& date) override;
+
+        virtual void save(CitySnapshot& snapshot, CitySnapshot::Character& record) const override;
 };
 
 #endif // WANDERINGCHARACTER_HPP
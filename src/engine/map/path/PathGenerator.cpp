@@ -8,12 +8,20 @@
 
 
 
+PathGenerator::PathGenerator(std::mt19937& randomGenerator) :
+    randomGenerator(randomGenerator)
+{
+
+}
+
+
+
 QSharedPointer<PathInterface> PathGenerator::generateWanderingPath(
     const Tile& origin,
     const int wanderingCredits
 ) const {
 
-    return QSharedPointer<PathInterface>(new RandomRoadPath(origin, wanderingCredits));
+    return QSharedPointer<PathInterface>(new RandomRoadPath(randomGenerator, origin, wanderingCredits));
 }
 
 
@@ -1,13 +1,20 @@
 #ifndef PATHGENERATOR_HPP
 #define PATHGENERATOR_HPP
 
+#include <random>
+
 #include "src/engine/map/path/PathGeneratorInterface.hpp"
 
 class Tile;
 
 class PathGenerator : public PathGeneratorInterface
 {
+    private:
+        std::mt19937& randomGenerator;///< The random generator of the map, for the wandering paths.
+
     public:
+        explicit PathGenerator(std::mt19937& randomGenerator);
+
         virtual QSharedPointer<PathInterface> generateWanderingPath(
             const Tile& origin,
             const int wanderingCredits
@@ -1,6 +1,7 @@
 #ifndef PATHINTERFACE_HPP
 #define PATHINTERFACE_HPP
 
+#include "src/engine/loader/CitySnapshot.hpp"
 #include "src/defines.hpp"
 
 class Tile;
@@ -10,9 +11,20 @@ class Tile;
  */
 class PathInterface
 {
+    public:
+        /**
+         * @brief The closed set of path types, used to identify a path without RTTI.
+         */
+        enum class Type {
+            RandomRoad,
+            Targeted,
+        };
+
     public:
         virtual ~PathInterface() {}
 
+        virtual Type getType() const = 0;
+
         /**
          * @brief Indicate if the path is obsolete.
          *
@@ -23,6 +35,11 @@ class PathInterface
 
         virtual bool isNextTileValid() const = 0;
         virtual const Tile& getNextTile() = 0;
+
+        /**
+         * @brief Save the path into the record, the tiles are appended to the tiles of the snapshot.
+         */
+        virtual void save(CitySnapshot& snapshot, CitySnapshot::Path& record) const = 0;
 };
 
 #endif // PATHINTERFACE_HPP
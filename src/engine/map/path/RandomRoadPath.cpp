@@ -1,13 +1,13 @@
 #include "RandomRoadPath.hpp"
 
 #include <QtCore/QList>
-#include <QtCore/QRandomGenerator>
 
 #include "src/engine/map/Tile.hpp"
 
 
 
-RandomRoadPath::RandomRoadPath(const Tile& initialLocation, const int wanderingCredits) :
+RandomRoadPath::RandomRoadPath(std::mt19937& randomGenerator, const Tile& initialLocation, const int wanderingCredits) :
+    randomGenerator(randomGenerator),
     previousTile(&initialLocation),
     currentTile(&initialLocation),
     wanderingCredits(wanderingCredits),
@@ -18,6 +18,31 @@ RandomRoadPath::RandomRoadPath(const Tile& initialLocation, const int wanderingC
 
 
 
+RandomRoadPath::RandomRoadPath(
+    std::mt19937& randomGenerator,
+    const Tile& previousTile,
+    const Tile& currentTile,
+    const int wanderingCredits,
+    const bool obsolete
+) :
+    randomGenerator(randomGenerator),
+    previousTile(&previousTile),
+    currentTile(&currentTile),
+    wanderingCredits(wanderingCredits),
+    obsolete(obsolete)
+{
+
+}
+
+
+
+PathInterface::Type RandomRoadPath::getType() const
+{
+    return Type::RandomRoad;
+}
+
+
+
 bool RandomRoadPath::isObsolete() const
 {
     return obsolete;
@@ -57,6 +82,19 @@ const Tile& RandomRoadPath::getNextTile()
 
 
 
+void RandomRoadPath::save(CitySnapshot& snapshot, CitySnapshot::Path& record) const
+{
+    record.type = static_cast<qint32>(Type::RandomRoad);
+    record.flags = obsolete ? CitySnapshot::Path::Obsolete : 0;
+    record.wanderingCredits = wanderingCredits;
+    record.firstTile = snapshot.pathTiles.size();
+    record.tileCount = 2;
+    snapshot.pathTiles.append({ previousTile->coordinates().x(), previousTile->coordinates().y() });
+    snapshot.pathTiles.append({ currentTile->coordinates().x(), currentTile->coordinates().y() });
+}
+
+
+
 optional<const Tile*> RandomRoadPath::getNextRandomTile() const
 {
     QList<const Tile*> roadNeighbours;
@@ -86,5 +124,7 @@ optional<const Tile*> RandomRoadPath::getNextRandomTile() const
     }
 
     // Choose random.
-    return roadNeighbours.at(QRandomGenerator::global()->bounded(0, roadNeighbours.size()));
+    std::uniform_int_distribution<int> distribution(0, roadNeighbours.size() - 1);
+
+    return roadNeighbours.at(distribution(randomGenerator));
 }
@@ -1,6 +1,8 @@
 #ifndef RANDOMROADPATH_HPP
 #define RANDOMROADPATH_HPP
 
+#include <random>
+
 #include "src/engine/map/path/PathInterface.hpp"
 
 class Tile;
@@ -8,20 +10,35 @@ class Tile;
 class RandomRoadPath : public PathInterface
 {
     private:
+        std::mt19937& randomGenerator;
         const Tile* previousTile;
         const Tile* currentTile;
         int wanderingCredits;
         bool obsolete;
 
     public:
-        RandomRoadPath(const Tile& initialLocation, const int wanderingCredits);
-
+        RandomRoadPath(std::mt19937& randomGenerator, const Tile& initialLocation, const int wanderingCredits);
+
+        /**
+         * @brief Restore a saved path.
+         */
+        RandomRoadPath(
+            std::mt19937& randomGenerator,
+            const Tile& previousTile,
+            const Tile& currentTile,
+            const int wanderingCredits,
+            const bool obsolete
+        );
+
+        virtual Type getType() const override;
         virtual bool isObsolete() const override;
         virtual bool isCompleted() const override;
 
         virtual bool isNextTileValid() const override;
         virtual const Tile& getNextTile() override;
 
+        virtual void save(CitySnapshot& snapshot, CitySnapshot::Path& record) const override;
+
     private:
         optional<const Tile*> getNextRandomTile() const;
 };
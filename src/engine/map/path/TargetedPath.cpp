@@ -10,13 +10,14 @@ TargetedPath::TargetedPath(
     bool restrictedToRoads,
     const QList<const Tile*>& path,
     optional<QWeakPointer<AbstractStaticElement>> target,
-    optional<const Tile*> targetTile
+    optional<const Tile*> targetTile,
+    const bool obsolete
 ) :
     restrictedToRoads(restrictedToRoads),
     path(path),
     _target(target),
     _targetTile(targetTile),
-    obsolete(false)
+    obsolete(obsolete)
 {
 
 }
@@ -39,6 +40,13 @@ const Tile& TargetedPath::targetTile() const
 
 
 
+PathInterface::Type TargetedPath::getType() const
+{
+    return Type::Targeted;
+}
+
+
+
 bool TargetedPath::isObsolete() const
 {
     return obsolete;
@@ -80,3 +88,29 @@ const Tile& TargetedPath::getNextTile()
 
     return *path.takeFirst();
 }
+
+
+
+void TargetedPath::save(CitySnapshot& snapshot, CitySnapshot::Path& record) const
+{
+    record.type = static_cast<qint32>(Type::Targeted);
+    record.flags = 0;
+    if (restrictedToRoads) {
+        record.flags |= CitySnapshot::Path::RestrictedToRoads;
+    }
+    if (obsolete) {
+        record.flags |= CitySnapshot::Path::Obsolete;
+    }
+    if (_targetTile) {
+        // The targets are natural resources, found back from their tile.
+        record.flags |= CitySnapshot::Path::HasTarget;
+        record.targetTile = { _targetTile->coordinates().x(), _targetTile->coordinates().y() };
+    }
+
+    // Only the remaining tiles of the path.
+    record.firstTile = snapshot.pathTiles.size();
+    record.tileCount = path.size();
+    for (auto tile : path) {
+        snapshot.pathTiles.append({ tile->coordinates().x(), tile->coordinates().y() });
+    }
+}
@@ -16,18 +16,22 @@ class TargetedPath : public PathInterface
             bool restrictedToRoads,
             const QList<const Tile*>& path,
             optional<QWeakPointer<AbstractStaticElement>> target = {},
-            optional<const Tile*> targetTile = nullptr
+            optional<const Tile*> targetTile = nullptr,
+            const bool obsolete = false
         );
 
         optional<QWeakPointer<AbstractStaticElement>> target() const;
         const Tile& targetTile() const;
 
+        virtual Type getType() const override;
         virtual bool isObsolete() const override;
         virtual bool isCompleted() const override;
 
         virtual bool isNextTileValid() const override;
         virtual const Tile& getNextTile() override;
 
+        virtual void save(CitySnapshot& snapshot, CitySnapshot::Path& record) const override;
+
     private:
         const bool restrictedToRoads;
         QList<const Tile*> path;
@@ -3,16 +3,48 @@
 
 #include <QtCore/QtGlobal>
 
+#include "src/defines.hpp"
+
 /**
- * @brief An empty base class for all static elements.
+ * @brief The base class for all static elements.
+ *
+ * Each static element carries its kind, so that the targets of the paths can be identified without RTTI (see castTo()).
  */
 class AbstractStaticElement
 {
         Q_DISABLE_COPY_MOVE(AbstractStaticElement)
 
     public:
-        AbstractStaticElement() {};
+        /**
+         * @brief The closed set of static element kinds.
+         */
+        enum class Kind {
+            Building,
+            NatureElement,
+        };
+
+    private:
+        const Kind kind;
+
+    public:
+        explicit AbstractStaticElement(const Kind kind) : kind(kind) {};
         virtual ~AbstractStaticElement() {};
+
+        Kind getKind() const
+        {
+            return kind;
+        }
+
+        /**
+         * @brief Cast the element to the given class if it is of its kind.
+         *
+         * The class must declare its kind in a `KIND` constant.
+         */
+        template<class StaticElementClass>
+        optional<StaticElementClass*> castTo()
+        {
+            return kind == StaticElementClass::KIND ? static_cast<StaticElementClass*>(this) : nullptr;
+        }
 };
 
 #endif // ABSTRACTSTATICELEMENT_HPP
@@ -6,8 +6,10 @@
 #include "src/engine/map/staticElement/building/AbstractStoringBuilding.hpp"
 #include "src/engine/map/staticElement/building/CivilianEntryPoint.hpp"
 #include "src/engine/map/staticElement/natureElement/NatureElement.hpp"
+#include "src/engine/StateJournal.hpp"
 #include "src/exceptions/UnexpectedException.hpp"
 #include "src/global/conf/BuildingInformation.hpp"
+#include "src/global/conf/NatureElementInformation.hpp"
 
 
 
@@ -22,11 +24,16 @@ StaticElementRegistry::StaticElementRegistry(
     buildingSearchEngine(),
     natureElementSearchEngine(pathGenerator),
     factory(characterGenerator, civilianEntryPoint, populationRegistry, buildingSearchEngine, natureElementSearchEngine),
+    processableBuildingHandles(),
     buildings(),
     natureElements(),
-    processableElements()
+    processableElements(),
+    stateJournal(nullptr)
 {
     // IMPORTANT: characterGenerator is not initialized yet within constructor scope!
+
+    // The civilian entry point is owned by the map, but the characters it generates still need to resolve it.
+    civilianEntryPoint.setHandle(processableBuildingHandles.insert(&civilianEntryPoint));
 }
 
 
@@ -45,6 +52,13 @@ const NatureElementSearchEngine& StaticElementRegistry::getNatureElementSearchEn
 
 
 
+optional<AbstractProcessableBuilding*> StaticElementRegistry::resolveBuilding(const BuildingHandle& handle) const
+{
+    return processableBuildingHandles.resolve(handle);
+}
+
+
+
 void StaticElementRegistry::generateBuilding(
     const BuildingInformation& conf,
     const TileArea& area,
@@ -62,7 +76,14 @@ void StaticElementRegistry::generateBuilding(
     }
 
     assert(!building.isNull());
-    buildings.insert(building.get(), building);
+    // The non-processable buildings have no handle, they are identified by their rank instead. A packed handle always
+    // has a non-zero generation in its upper half, so both kinds of IDs never collide.
+    building->setId(buildings.size());
+    buildings.append(building);
+    if (stateJournal) {
+        building->setStateJournal(stateJournal);
+        stateJournal->registerBuilding(*building);
+    }
 }
 
 
@@ -119,23 +140,35 @@ void StaticElementRegistry::generateProcessableBuilding(
     }
 
     assert(!building.isNull());
-    buildings.insert(building.get(), building);
-    processableElements.insert(building.get(), building);
+    building->setHandle(processableBuildingHandles.insert(building.get()));
+    buildings.append(building);
+    processableElements.append(building);
     if (conf.getMaxWorkers() > 0) {
         workingPlaceRegistry.registerWorkingPlace(building);
     }
+    if (stateJournal) {
+        building->setStateJournal(stateJournal);
+        stateJournal->registerBuilding(*building);
+    }
 }
 
 
 
-void StaticElementRegistry::generateNatureElement(const NatureElementInformation& conf, const TileArea& area)
-{
+QSharedPointer<NatureElement> StaticElementRegistry::generateNatureElement(
+    const NatureElementInformation& conf,
+    const TileArea& area
+) {
     QSharedPointer<NatureElement> natureElement(new NatureElement(conf, area));
-    natureElements.insert(natureElement.get(), natureElement);
+    natureElements.append(natureElement);
     natureElementSearchEngine.registerNaturalResource(natureElement);
+    if (stateJournal) {
+        stateJournal->registerNatureElement(*natureElement);
+    }
 
     // Note: For now, we do not have processable nature elements. But trees will typically become processable in order
     // to grow after cutting.
+
+    return natureElement;
 }
 
 
@@ -143,7 +176,7 @@ void StaticElementRegistry::generateNatureElement(const NatureElementInformation
 QList<BuildingState> StaticElementRegistry::getBuildingsState() const
 {
     QList<BuildingState> list;
-    for (auto building : buildings) {
+    for (auto& building : buildings) {
         list.append(building->getCurrentState());
     }
 
@@ -155,7 +188,7 @@ QList<BuildingState> StaticElementRegistry::getBuildingsState() const
 QList<NatureElementState> StaticElementRegistry::getNatureElementsState() const
 {
     QList<NatureElementState> list;
-    for (auto natureElement : natureElements) {
+    for (auto& natureElement : natureElements) {
         list.append(natureElement->getState());
     }
 
@@ -164,9 +197,63 @@ QList<NatureElementState> StaticElementRegistry::getNatureElementsState() const
 
 
 
+void StaticElementRegistry::attachStateJournal(StateJournal& journal)
+{
+    stateJournal = &journal;
+    for (auto& building : buildings) {
+        building->setStateJournal(stateJournal);
+        journal.registerBuilding(*building);
+    }
+    for (auto& natureElement : natureElements) {
+        journal.registerNatureElement(*natureElement);
+    }
+}
+
+
+
+void StaticElementRegistry::save(CitySnapshot& snapshot) const
+{
+    snapshot.natureElements.resize(natureElements.size());
+    for (int i(0); i < natureElements.size(); ++i) {
+        auto& natureElement(*natureElements.at(i));
+        auto& area(natureElement.getArea());
+        auto& record(snapshot.natureElements[i]);
+        record.conf = CitySnapshot::indexKey(snapshot.natureElementKeys, natureElement.getConf().getKey());
+        record.leftCorner = { area.leftCorner().x(), area.leftCorner().y() };
+        record.width = area.size().width();
+        record.height = area.size().height();
+        record.flags = natureElement.isBusy() ? CitySnapshot::NatureElement::Busy : 0;
+    }
+
+    snapshot.buildings.resize(buildings.size());
+    for (int i(0); i < buildings.size(); ++i) {
+        buildings.at(i)->save(snapshot, snapshot.buildings[i]);
+    }
+}
+
+
+
+void StaticElementRegistry::restore(const CitySnapshot& snapshot)
+{
+    if (buildings.size() != snapshot.buildings.size() || natureElements.size() != snapshot.natureElements.size()) {
+        throw UnexpectedException("The static elements do not match the city snapshot.");
+    }
+
+    for (int i(0); i < natureElements.size(); ++i) {
+        if (snapshot.natureElements.at(i).flags & CitySnapshot::NatureElement::Busy) {
+            natureElements.at(i)->startInteraction();
+        }
+    }
+    for (int i(0); i < buildings.size(); ++i) {
+        buildings.at(i)->restore(snapshot, snapshot.buildings.at(i));
+    }
+}
+
+
+
 void StaticElementRegistry::process(const CycleDate& date)
 {
-    for (auto processableElement : processableElements) {
+    for (auto& processableElement : processableElements) {
         processableElement->process(date);
     }
 }
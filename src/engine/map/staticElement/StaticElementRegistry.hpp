@@ -1,10 +1,12 @@
 #ifndef STATICELEMENTREGISTRY_HPP
 #define STATICELEMENTREGISTRY_HPP
 
-#include <QtCore/QHash>
 #include <QtCore/QList>
 #include <QtCore/QSharedPointer>
+#include <QtCore/QVector>
 
+#include "src/engine/loader/CitySnapshot.hpp"
+#include "src/engine/map/staticElement/building/BuildingResolverInterface.hpp"
 #include "src/engine/map/staticElement/building/BuildingSearchEngine.hpp"
 #include "src/engine/map/staticElement/natureElement/NatureElementSearchEngine.hpp"
 #include "src/engine/map/staticElement/StaticElementFactory.hpp"
@@ -17,9 +19,16 @@ class CharacterInformation;
 class CivilianEntryPoint;
 class NatureElement;
 class PathGeneratorInterface;
+class StateJournal;
 class WorkingPlaceRegistryInterface;
 
-class StaticElementRegistry : public AbstractProcessable
+/**
+ * @brief Owns all the static elements of the map.
+ *
+ * Static elements are never destroyed for now, so they are simply kept in vectors, in creation order. Processing them
+ * is a linear walk in a deterministic order.
+ */
+class StaticElementRegistry : public AbstractProcessable, public BuildingResolverInterface
 {
         Q_DISABLE_COPY_MOVE(StaticElementRegistry)
 
@@ -36,6 +45,9 @@ class StaticElementRegistry : public AbstractProcessable
         const BuildingSearchEngine& getBuildingSearchEngine() const;
         const NatureElementSearchEngine& getNatureElementSearchEngine() const;
 
+        // Handles.
+        virtual optional<AbstractProcessableBuilding*> resolveBuilding(const BuildingHandle& handle) const override;
+
         // Element registration.
         void generateBuilding(const BuildingInformation& conf, const TileArea& area, Direction orientation);
         void generateProcessableBuilding(
@@ -44,12 +56,30 @@ class StaticElementRegistry : public AbstractProcessable
             Direction orientation,
             const Tile& entryPointTile
         );
-        void generateNatureElement(const NatureElementInformation& conf, const TileArea& area);
+        QSharedPointer<NatureElement> generateNatureElement(const NatureElementInformation& conf, const TileArea& area);
 
         // States.
         QList<BuildingState> getBuildingsState() const;
         QList<NatureElementState> getNatureElementsState() const;
 
+        /**
+         * @brief Register all the elements in the journal, then let them report their changes to it.
+         *
+         * The elements generated afterwards are registered as well. The journal must outlive the registry.
+         */
+        void attachStateJournal(StateJournal& journal);
+
+        // Snapshot.
+        void save(CitySnapshot& snapshot) const;
+
+        /**
+         * @brief Restore the state of the buildings and nature elements generated from the snapshot.
+         *
+         * The elements must have been generated in the order of the snapshot. Since the static elements are never
+         * destroyed, they get back the handles they had when saved.
+         */
+        void restore(const CitySnapshot& snapshot);
+
         virtual void process(const CycleDate& date) override;
 
     private:
@@ -57,9 +87,11 @@ class StaticElementRegistry : public AbstractProcessable
         BuildingSearchEngine buildingSearchEngine;
         NatureElementSearchEngine natureElementSearchEngine;
         StaticElementFactory factory;
-        QHash<AbstractBuilding*, QSharedPointer<AbstractBuilding>> buildings;
-        QHash<NatureElement*, QSharedPointer<NatureElement>> natureElements;
-        QHash<AbstractProcessable*, QSharedPointer<AbstractProcessable>> processableElements; ///< Contains any element that is processable (from `buildings` or `natureElements`)
+        HandleTable<AbstractProcessableBuilding> processableBuildingHandles; ///< Also references the civilian entry point.
+        QVector<QSharedPointer<AbstractBuilding>> buildings;
+        QVector<QSharedPointer<NatureElement>> natureElements;
+        QVector<QSharedPointer<AbstractProcessable>> processableElements; ///< Contains any element that is processable (from `buildings` or `natureElements`)
+        optional<StateJournal*> stateJournal;
 };
 
 #endif // STATICELEMENTREGISTRY_HPP
@@ -1,15 +1,19 @@
 #include "AbstractBuilding.hpp"
 
+#include "src/engine/StateJournal.hpp"
+#include "src/global/conf/BuildingInformation.hpp"
 #include "src/global/state/BuildingState.hpp"
 
 
 
 AbstractBuilding::AbstractBuilding(const BuildingInformation& conf, const TileArea& area, Direction orientation) :
-    AbstractStaticElement(),
+    AbstractStaticElement(KIND),
     conf(conf),
     area(area),
     orientation(orientation),
-    stateVersion(0)
+    stateVersion(0),
+    id(0),
+    stateJournal(nullptr)
 {
 
 }
@@ -30,9 +34,46 @@ const BuildingInformation& AbstractBuilding::getConf() const
 
 
 
+quint64 AbstractBuilding::getId() const
+{
+    return id;
+}
+
+
+
+void AbstractBuilding::setId(const quint64 id)
+{
+    this->id = id;
+}
+
+
+
+void AbstractBuilding::setStateJournal(optional<StateJournal*> stateJournal)
+{
+    this->stateJournal = stateJournal;
+}
+
+
+
 BuildingState AbstractBuilding::getCurrentState() const
 {
-    return { reinterpret_cast<qintptr>(this), conf, area, orientation, BuildingStatus::Inactive, 0, stateVersion };
+    return { id, conf, area, orientation, BuildingStatus::Inactive, 0, stateVersion };
+}
+
+
+
+void AbstractBuilding::save(CitySnapshot& snapshot, CitySnapshot::Building& record) const
+{
+    record.conf = CitySnapshot::indexKey(snapshot.buildingKeys, conf.getKey());
+    record.orientation = static_cast<qint32>(orientation);
+    record.leftCorner = { area.leftCorner().x(), area.leftCorner().y() };
+}
+
+
+
+void AbstractBuilding::restore(const CitySnapshot& /*snapshot*/, const CitySnapshot::Building& /*record*/)
+{
+
 }
 
 
@@ -40,4 +81,7 @@ BuildingState AbstractBuilding::getCurrentState() const
 void AbstractBuilding::notifyViewDataChange()
 {
     ++stateVersion;
+    if (stateJournal) {
+        stateJournal->notifyBuildingChange(*this);
+    }
 }
@@ -1,11 +1,14 @@
 #ifndef ABSTRACTBUILDING_HPP
 #define ABSTRACTBUILDING_HPP
 
+#include "src/engine/loader/CitySnapshot.hpp"
 #include "src/engine/map/staticElement/AbstractStaticElement.hpp"
 #include "src/global/geometry/TileArea.hpp"
 #include "src/global/Direction.hpp"
+#include "src/defines.hpp"
 
 class BuildingInformation;
+class StateJournal;
 struct BuildingState;
 
 /**
@@ -16,19 +19,58 @@ struct BuildingState;
  */
 class AbstractBuilding : public AbstractStaticElement
 {
+    public:
+        static constexpr Kind KIND = Kind::Building;
+
     protected:
         const BuildingInformation& conf;
         const TileArea area;
         const Direction orientation;
         int stateVersion; ///< We use an int for the versionning of the view. Note that an overflow is not dramatic since we always compare versions using equality.
 
+    private:
+        quint64 id;
+        optional<StateJournal*> stateJournal; ///< The journal to notify about the changes of the building, if any.
+
     public:
         AbstractBuilding(const BuildingInformation& conf, const TileArea& area, Direction orientation);
         virtual ~AbstractBuilding();
 
         const BuildingInformation& getConf() const;
+
+        /**
+         * @brief Get the ID identifying the building in its states and in the state deltas.
+         */
+        quint64 getId() const;
+
+        /**
+         * @brief Set the ID of the building, unique among the buildings of the map.
+         *
+         * Must be called once by the registry owning the building.
+         */
+        void setId(const quint64 id);
+
+        /**
+         * @brief Set the journal to notify about the changes of the building.
+         *
+         * The journal must outlive the building.
+         */
+        void setStateJournal(optional<StateJournal*> stateJournal);
+
         virtual BuildingState getCurrentState() const;
 
+        /**
+         * @brief Save the building into its record.
+         *
+         * Each kind of building saves its own state on top of the state of its parent class.
+         */
+        virtual void save(CitySnapshot& snapshot, CitySnapshot::Building& record) const;
+
+        /**
+         * @brief Restore the state saved by save(), once all the elements of the map have been restored.
+         */
+        virtual void restore(const CitySnapshot& snapshot, const CitySnapshot::Building& record);
+
     protected:
         void notifyViewDataChange();
 };
@@ -1,5 +1,6 @@
 #include "AbstractProcessableBuilding.hpp"
 
+#include "src/engine/map/Tile.hpp"
 #include "src/global/conf/BuildingInformation.hpp"
 #include "src/global/state/BuildingState.hpp"
 
@@ -14,16 +15,24 @@ AbstractProcessableBuilding::AbstractProcessableBuilding(
     AbstractBuilding(conf, area, orientation),
     entryPointTile(entryPointTile),
     currentWorkerQuantity(0),
-    selfReference(nullptr)
+    handle()
 {
 
 }
 
 
 
-QWeakPointer<AbstractProcessableBuilding> AbstractProcessableBuilding::getSelfReference() const
+const BuildingHandle& AbstractProcessableBuilding::getHandle() const
 {
-    return selfReference;
+    return handle;
+}
+
+
+
+void AbstractProcessableBuilding::setHandle(const BuildingHandle& handle)
+{
+    this->handle = handle;
+    setId(handle.pack());
 }
 
 
@@ -59,10 +68,19 @@ bool AbstractProcessableBuilding::processInteraction(const CycleDate& /*date*/,
 
 
 
+void AbstractProcessableBuilding::save(CitySnapshot& snapshot, CitySnapshot::Building& record) const
+{
+    AbstractBuilding::save(snapshot, record);
+    // The workers are saved by the population.
+    record.entryPoint = { entryPointTile.coordinates().x(), entryPointTile.coordinates().y() };
+}
+
+
+
 BuildingState AbstractProcessableBuilding::getCurrentState() const
 {
     return {
-        reinterpret_cast<qintptr>(this),
+        getId(),
         conf,
         area,
         orientation,
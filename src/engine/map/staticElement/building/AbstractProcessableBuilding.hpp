@@ -1,9 +1,8 @@
 #ifndef ABSTRACTPROCESSABLEBUILDING_HPP
 #define ABSTRACTPROCESSABLEBUILDING_HPP
 
-#include <QtCore/QWeakPointer>
-
 #include "src/engine/map/staticElement/building/AbstractBuilding.hpp"
+#include "src/engine/map/staticElement/building/BuildingResolverInterface.hpp"
 #include "src/engine/processing/AbstractProcessable.hpp"
 #include "src/global/geometry/TileCoordinates.hpp"
 #include "src/global/BuildingStatus.hpp"
@@ -17,9 +16,7 @@ class AbstractProcessableBuilding : public AbstractBuilding, public AbstractProc
     private:
         const Tile& entryPointTile;
         int currentWorkerQuantity;
-
-    protected:
-        QWeakPointer<AbstractProcessableBuilding> selfReference;
+        BuildingHandle handle;
 
     protected:
         AbstractProcessableBuilding(
@@ -30,7 +27,15 @@ class AbstractProcessableBuilding : public AbstractBuilding, public AbstractProc
         );
 
     public:
-        QWeakPointer<AbstractProcessableBuilding> getSelfReference() const;
+        const BuildingHandle& getHandle() const;
+
+        /**
+         * @brief Set the handle referencing the building in its registry.
+         *
+         * Must be called once by the registry owning the building.
+         */
+        void setHandle(const BuildingHandle& handle);
+
         const Tile& getEntryPointTile() const;
         bool isActive() const;
 
@@ -38,6 +43,8 @@ class AbstractProcessableBuilding : public AbstractBuilding, public AbstractProc
 
         virtual bool processInteraction(const CycleDate& date, Character& actor);
 
+        virtual void save(CitySnapshot& snapshot, CitySnapshot::Building& record) const override;
+
         virtual BuildingState getCurrentState() const override;
 
     protected:
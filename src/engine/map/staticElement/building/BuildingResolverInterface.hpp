@@ -0,0 +1,25 @@
+#ifndef BUILDINGRESOLVERINTERFACE_HPP
+#define BUILDINGRESOLVERINTERFACE_HPP
+
+#include "src/global/pointer/Handle.hpp"
+#include "src/defines.hpp"
+
+class AbstractProcessableBuilding;
+
+using BuildingHandle = Handle<AbstractProcessableBuilding>;
+
+/**
+ * @brief An interface for resolving the handles of the processable buildings.
+ */
+class BuildingResolverInterface
+{
+    public:
+        virtual ~BuildingResolverInterface() {};
+
+        /**
+         * @brief Get the building referenced by the given handle, or nullptr if it has been destroyed.
+         */
+        virtual optional<AbstractProcessableBuilding*> resolveBuilding(const BuildingHandle& handle) const = 0;
+};
+
+#endif // BUILDINGRESOLVERINTERFACE_HPP
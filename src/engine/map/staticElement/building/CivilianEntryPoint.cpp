@@ -1,7 +1,6 @@
 #include "CivilianEntryPoint.hpp"
 
 #include <QtCore/QException>
-#include <QtCore/QRandomGenerator>
 
 #include "src/engine/map/dynamicElement/character/ImmigrantCharacter.hpp"
 #include "src/engine/map/dynamicElement/CharacterGeneratorInterface.hpp"
@@ -10,44 +9,58 @@
 
 
 CivilianEntryPoint::CivilianEntryPoint(
+    const BuildingResolverInterface& buildingResolver,
     CharacterGeneratorInterface& characterFactory,
     const BuildingInformation& conf,
     const TileArea& area,
     Direction orientation,
     const Tile& entryPointTile,
-    const CharacterInformation& immigrantConf
+    const CharacterInformation& immigrantConf,
+    std::mt19937& randomGenerator
 ) :
     AbstractProcessableBuilding(conf, area, orientation, entryPointTile),
+    buildingResolver(buildingResolver),
     characterFactory(characterFactory),
     immigrantConf(immigrantConf),
+    randomGenerator(randomGenerator),
     nextImmigrantGenerationCountDown(),
     immigrantRequestQueue()
 {
-    // IMPORTANT: characterFactory is not initialized yet within constructor scope!
+    // IMPORTANT: buildingResolver & characterFactory are not initialized yet within constructor scope!
     setupNextImmigrantGenerationDate();
 }
 
 
 
 QSharedPointer<CivilianEntryPoint> CivilianEntryPoint::Create(
+    const BuildingResolverInterface& buildingResolver,
     CharacterGeneratorInterface& characterFactory,
     const BuildingInformation& conf,
     const TileArea& area,
     Direction orientation,
     const Tile& entryPointTile,
-    const CharacterInformation& immigrantConf
+    const CharacterInformation& immigrantConf,
+    std::mt19937& randomGenerator
 ) {
-    // IMPORTANT: characterFactory is not initialized yet within constructor scope!
-    auto entryPoint(new CivilianEntryPoint(characterFactory, conf, area, orientation, entryPointTile, immigrantConf));
+    // IMPORTANT: buildingResolver & characterFactory are not initialized yet within constructor scope!
+    auto entryPoint(new CivilianEntryPoint(
+        buildingResolver,
+        characterFactory,
+        conf,
+        area,
+        orientation,
+        entryPointTile,
+        immigrantConf,
+        randomGenerator
+    ));
     QSharedPointer<CivilianEntryPoint> pointer(entryPoint);
-    entryPoint->selfReference = pointer;
 
     return pointer;
 }
 
 
 
-void CivilianEntryPoint::requestImmigrant(const QWeakPointer<AbstractProcessableBuilding>& requester)
+void CivilianEntryPoint::requestImmigrant(const BuildingHandle& requester)
 {
     immigrantRequestQueue.append(requester);
 }
@@ -63,9 +76,9 @@ void CivilianEntryPoint::process(const CycleDate& /*date*/)
     --nextImmigrantGenerationCountDown;
     if (nextImmigrantGenerationCountDown <= 0) {
         do {
-            auto issuer(immigrantRequestQueue.takeFirst().toStrongRef());
+            auto issuer(buildingResolver.resolveBuilding(immigrantRequestQueue.takeFirst()));
             if (issuer) {
-                characterFactory.generateImmigrant(immigrantConf, selfReference, issuer->getSelfReference());
+                characterFactory.generateImmigrant(immigrantConf, *this, *issuer);
                 setupNextImmigrantGenerationDate();
                 break;
             }
@@ -75,10 +88,32 @@ void CivilianEntryPoint::process(const CycleDate& /*date*/)
 
 
 
+void CivilianEntryPoint::save(CitySnapshot& snapshot, CitySnapshot::Building& record) const
+{
+    AbstractProcessableBuilding::save(snapshot, record);
+    record.countDown = nextImmigrantGenerationCountDown;
+    record.firstValue = snapshot.values.size();
+    record.valueCount = immigrantRequestQueue.size();
+    for (auto& requester : immigrantRequestQueue) {
+        snapshot.values.append(requester.pack());
+    }
+}
+
+
+
+void CivilianEntryPoint::restore(const CitySnapshot& snapshot, const CitySnapshot::Building& record)
+{
+    nextImmigrantGenerationCountDown = record.countDown;
+    immigrantRequestQueue.clear();
+    for (int i(0); i < record.valueCount; ++i) {
+        immigrantRequestQueue.append(BuildingHandle::unpack(snapshot.values.at(record.firstValue + i)));
+    }
+}
+
+
+
 void CivilianEntryPoint::setupNextImmigrantGenerationDate()
 {
-    nextImmigrantGenerationCountDown = QRandomGenerator::global()->bounded(
-        MIN_IMMIGRANT_GENERATION_INTERVAL,
-        MAX_IMMIGRANT_GENERATION_INTERVAL + 1
-    );
+    std::uniform_int_distribution<int> interval(MIN_IMMIGRANT_GENERATION_INTERVAL, MAX_IMMIGRANT_GENERATION_INTERVAL);
+    nextImmigrantGenerationCountDown = interval(randomGenerator);
 }
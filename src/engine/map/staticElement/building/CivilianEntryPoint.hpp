@@ -2,10 +2,12 @@
 #define MAPENTRYPOINT_HPP
 
 #include <QtCore/QSharedPointer>
+#include <random>
 
 #include "src/engine/map/staticElement/building/AbstractProcessableBuilding.hpp"
 #include "src/engine/map/staticElement/building/ImmigrantGeneratorInterface.hpp"
 
+class BuildingResolverInterface;
 class CharacterGeneratorInterface;
 class CharacterInformation;
 
@@ -21,35 +23,44 @@ class CivilianEntryPoint : public AbstractProcessableBuilding, public ImmigrantG
         const int MAX_IMMIGRANT_GENERATION_INTERVAL = 90;
 
     private:
+        const BuildingResolverInterface& buildingResolver;
         CharacterGeneratorInterface& characterFactory;
         const CharacterInformation& immigrantConf;
+        std::mt19937& randomGenerator;///< The random generator of the map.
         int nextImmigrantGenerationCountDown;
-        QList<QWeakPointer<AbstractProcessableBuilding>> immigrantRequestQueue;
+        QList<BuildingHandle> immigrantRequestQueue;
 
     private:
         CivilianEntryPoint(
+            const BuildingResolverInterface& buildingResolver,
             CharacterGeneratorInterface& characterFactory,
             const BuildingInformation& conf,
             const TileArea& area,
             Direction orientation,
             const Tile& entryPointTile,
-            const CharacterInformation& immigrantConf
+            const CharacterInformation& immigrantConf,
+            std::mt19937& randomGenerator
         );
 
     public:
         static QSharedPointer<CivilianEntryPoint> Create(
+            const BuildingResolverInterface& buildingResolver,
             CharacterGeneratorInterface& characterFactory,
             const BuildingInformation& conf,
             const TileArea& area,
             Direction orientation,
             const Tile& entryPointTile,
-            const CharacterInformation& immigrantConf
+            const CharacterInformation& immigrantConf,
+            std::mt19937& randomGenerator
         );
 
-        virtual void requestImmigrant(const QWeakPointer<AbstractProcessableBuilding>& requester) override;
+        virtual void requestImmigrant(const BuildingHandle& requester) override;
 
         virtual void process(const CycleDate& date) override;
 
+        virtual void save(CitySnapshot& snapshot, CitySnapshot::Building& record) const override;
+        virtual void restore(const CitySnapshot& snapshot, const CitySnapshot::Building& record) override;
+
     private:
         void setupNextImmigrantGenerationDate();
 };
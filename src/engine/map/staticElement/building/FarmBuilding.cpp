@@ -6,7 +6,6 @@
 #include "src/engine/map/dynamicElement/CharacterGeneratorInterface.hpp"
 #include "src/engine/processing/CycleDate.hpp"
 #include "src/global/conf/BuildingInformation.hpp"
-#include "src/global/pointer/SmartPointerUtils.hpp"
 #include "src/global/state/BuildingState.hpp"
 
 
@@ -38,7 +37,6 @@ QSharedPointer<AbstractProcessableBuilding> FarmBuilding::Create(
 ) {
     auto farm(new FarmBuilding(characterFactory, conf, area, orientation, entryPointTile));
     QSharedPointer<AbstractProcessableBuilding> pointer(farm);
-    farm->selfReference = pointer;
 
     return pointer;
 }
@@ -57,8 +55,7 @@ void FarmBuilding::process(const CycleDate& date)
     }
 
     if (date.isFirstCycleOfMonth() && date.getMonth() == conf.getFarmConf().harvestMonth) {
-        auto deliveryMan(this->deliveryMan.toStrongRef());
-        if (deliveryMan) {
+        if (characterFactory.isAlive(deliveryMan)) {
             // The delivery man is outside. We do not harvest now.
             // Next harvest will occure as soon as the growing is complete and thedelivery man is back.
             return;
@@ -68,8 +65,7 @@ void FarmBuilding::process(const CycleDate& date)
     }
     else if (growingCountDown <= 0) {
         // Case where the delivery man were outside at the begining of the harvest month.
-        auto deliveryMan(this->deliveryMan.toStrongRef());
-        if (deliveryMan) {
+        if (characterFactory.isAlive(deliveryMan)) {
             // The delivery man is still outside. We do not harvest now.
             return;
         }
@@ -82,7 +78,7 @@ void FarmBuilding::process(const CycleDate& date)
 
 bool FarmBuilding::processInteraction(const CycleDate& /*date*/, Character& actor)
 {
-    if (matches(deliveryMan, actor)) {
+    if (actor.getHandle() == deliveryMan) {
         deliveryMan.clear();
 
         return true;
@@ -93,10 +89,27 @@ bool FarmBuilding::processInteraction(const CycleDate& /*date*/, Character& acto
 
 
 
+void FarmBuilding::save(CitySnapshot& snapshot, CitySnapshot::Building& record) const
+{
+    AbstractProcessableBuilding::save(snapshot, record);
+    record.countDown = growingCountDown;
+    record.character = deliveryMan.pack();
+}
+
+
+
+void FarmBuilding::restore(const CitySnapshot& /*snapshot*/, const CitySnapshot::Building& record)
+{
+    growingCountDown = record.countDown;
+    deliveryMan = CharacterHandle::unpack(record.character);
+}
+
+
+
 BuildingState FarmBuilding::getCurrentState() const
 {
     return BuildingState::CreateFarmState(
-        reinterpret_cast<qintptr>(this),
+        getId(),
         conf,
         area,
         orientation,
@@ -126,7 +139,7 @@ void FarmBuilding::harvest()
 
     deliveryMan = characterFactory.generateDeliveryMan(
         conf.getFarmConf().deliveryManConf,
-        selfReference,
+        *this,
         conf.getFarmConf().producedItemConf,
         quantity
     );
@@ -1,11 +1,9 @@
 #ifndef FARMBUILDING_HPP
 #define FARMBUILDING_HPP
 
-#include <QtCore/QWeakPointer>
-
+#include "src/engine/map/dynamicElement/CharacterGeneratorInterface.hpp"
 #include "src/engine/map/staticElement/building/AbstractProcessableBuilding.hpp"
 
-class CharacterGeneratorInterface;
 class ItemInformation;
 
 class FarmBuilding : public AbstractProcessableBuilding
@@ -14,7 +12,7 @@ class FarmBuilding : public AbstractProcessableBuilding
         const int GROWING_INTERVAL;
         CharacterGeneratorInterface& characterFactory;
         int growingCountDown;
-        QWeakPointer<Character> deliveryMan;
+        CharacterHandle deliveryMan;
 
     private:
         FarmBuilding(
@@ -37,6 +35,9 @@ class FarmBuilding : public AbstractProcessableBuilding
         virtual void process(const CycleDate& date) override;
         virtual bool processInteraction(const CycleDate& date, Character& actor) override;
 
+        virtual void save(CitySnapshot& snapshot, CitySnapshot::Building& record) const override;
+        virtual void restore(const CitySnapshot& snapshot, const CitySnapshot::Building& record) override;
+
         virtual BuildingState getCurrentState() const override;
 
     private:
@@ -38,7 +38,6 @@ QSharedPointer<AbstractProcessableBuilding> HouseBuilding::Create(
 ) {
     auto house(new HouseBuilding(immigrantGenerator, populationRegister, conf, area, orientation, entryPointTile));
     QSharedPointer<AbstractProcessableBuilding> pointer(house);
-    house->selfReference = pointer;
 
     return pointer;
 }
@@ -48,7 +47,7 @@ QSharedPointer<AbstractProcessableBuilding> HouseBuilding::Create(
 void HouseBuilding::process(const CycleDate& /*date*/)
 {
     if (!hasRequestedInhabitants && inhabitants < conf.getHouseConf().populationCapacity) {
-        immigrantGenerator.requestImmigrant(selfReference);
+        immigrantGenerator.requestImmigrant(getHandle());
         hasRequestedInhabitants = true;
     }
 }
@@ -57,7 +56,7 @@ void HouseBuilding::process(const CycleDate& /*date*/)
 
 bool HouseBuilding::processInteraction(const CycleDate& /*date*/, Character& actor)
 {
-    auto immigrant(dynamic_cast<ImmigrantCharacter*>(&actor));
+    auto immigrant(actor.castTo<ImmigrantCharacter>());
     if (immigrant) {
         int inhabitantsDelta(qMin(
             conf.getHouseConf().populationPerImmigrant,
@@ -67,7 +66,7 @@ bool HouseBuilding::processInteraction(const CycleDate& /*date*/, Character& act
         populationRegister.registerPopulation(inhabitantsDelta);
 
         if (inhabitants < conf.getHouseConf().populationCapacity) {
-            immigrantGenerator.requestImmigrant(selfReference);
+            immigrantGenerator.requestImmigrant(getHandle());
         }
         else {
             hasRequestedInhabitants = false;
@@ -81,10 +80,30 @@ bool HouseBuilding::processInteraction(const CycleDate& /*date*/, Character& act
 
 
 
+void HouseBuilding::save(CitySnapshot& snapshot, CitySnapshot::Building& record) const
+{
+    AbstractProcessableBuilding::save(snapshot, record);
+    record.quantity = inhabitants;
+    if (hasRequestedInhabitants) {
+        record.flags |= CitySnapshot::Building::HasRequestedInhabitants;
+    }
+}
+
+
+
+void HouseBuilding::restore(const CitySnapshot& /*snapshot*/, const CitySnapshot::Building& record)
+{
+    // The inhabitants are already part of the restored population.
+    inhabitants = record.quantity;
+    hasRequestedInhabitants = record.flags & CitySnapshot::Building::HasRequestedInhabitants;
+}
+
+
+
 BuildingState HouseBuilding::getCurrentState() const
 {
     return BuildingState::CreateHouseState(
-        reinterpret_cast<qintptr>(this),
+        getId(),
         conf,
         area,
         orientation,
@@ -41,6 +41,9 @@ class HouseBuilding : public AbstractProcessableBuilding
         virtual void process(const CycleDate& date) override;
         virtual bool processInteraction(const CycleDate& date, Character& actor) override;
 
+        virtual void save(CitySnapshot& snapshot, CitySnapshot::Building& record) const override;
+        virtual void restore(const CitySnapshot& snapshot, const CitySnapshot::Building& record) override;
+
         virtual BuildingState getCurrentState() const override;
 };
 
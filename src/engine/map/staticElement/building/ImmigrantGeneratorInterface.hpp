@@ -1,9 +1,7 @@
 #ifndef IMMIGRANTGENERATORINTERFACE_HPP
 #define IMMIGRANTGENERATORINTERFACE_HPP
 
-#include <QtCore/QWeakPointer>
-
-class AbstractProcessableBuilding;
+#include "src/engine/map/staticElement/building/BuildingResolverInterface.hpp"
 
 class ImmigrantGeneratorInterface
 {
@@ -15,7 +13,7 @@ class ImmigrantGeneratorInterface
          *
          * The immigrant will be generated at a random moment.
          */
-        virtual void requestImmigrant(const QWeakPointer<AbstractProcessableBuilding>& requester) = 0;
+        virtual void requestImmigrant(const BuildingHandle& requester) = 0;
 };
 
 #endif // IMMIGRANTGENERATORINTERFACE_HPP
@@ -4,7 +4,6 @@
 #include "src/engine/map/dynamicElement/CharacterGeneratorInterface.hpp"
 #include "src/global/conf/BuildingInformation.hpp"
 #include "src/global/conf/ItemInformation.hpp"
-#include "src/global/pointer/SmartPointerUtils.hpp"
 #include "src/global/state/BuildingState.hpp"
 
 
@@ -18,7 +17,6 @@ QSharedPointer<AbstractStoringBuilding> IndustrialBuilding::Create(
 ) {
     auto industrial(new IndustrialBuilding(characterGenerator, conf, area, orientation, entryPointTile));
     QSharedPointer<AbstractStoringBuilding> pointer(industrial);
-    industrial->selfReference = pointer;
 
     return pointer;
 }
@@ -68,13 +66,13 @@ void IndustrialBuilding::process(const CycleDate& /*date*/)
 
 bool IndustrialBuilding::processInteraction(const CycleDate& /*date*/, Character& actor)
 {
-    if (matches(deliveryMan, actor)) {
+    if (actor.getHandle() == deliveryMan) {
         deliveryMan.clear();
 
         return true;
     }
 
-    auto deliveryMan(dynamic_cast<DeliveryManCharacter*>(&actor));
+    auto deliveryMan(actor.castTo<DeliveryManCharacter>());
     if (deliveryMan) {
         auto& item(deliveryMan->getTransportedItemConf());
         if (item != conf.getIndustrialConf().rawMaterialConf) {
@@ -94,10 +92,29 @@ bool IndustrialBuilding::processInteraction(const CycleDate& /*date*/, Character
 
 
 
+void IndustrialBuilding::save(CitySnapshot& snapshot, CitySnapshot::Building& record) const
+{
+    AbstractStoringBuilding::save(snapshot, record);
+    record.quantity = rawMaterialStock;
+    record.character = deliveryMan.pack();
+    record.countDown = productionCountDown;
+}
+
+
+
+void IndustrialBuilding::restore(const CitySnapshot& /*snapshot*/, const CitySnapshot::Building& record)
+{
+    rawMaterialStock = record.quantity;
+    deliveryMan = CharacterHandle::unpack(record.character);
+    productionCountDown = record.countDown;
+}
+
+
+
 BuildingState IndustrialBuilding::getCurrentState() const
 {
     return BuildingState::CreateIndustrialState(
-        reinterpret_cast<qintptr>(this),
+        getId(),
         conf,
         area,
         orientation,
@@ -149,10 +166,10 @@ IndustrialBuilding::IndustrialBuilding(
 
 void IndustrialBuilding::handleProduction()
 {
-    if (!deliveryMan) {
+    if (!characterGenerator.isAlive(deliveryMan)) {
         deliveryMan = characterGenerator.generateDeliveryMan(
             conf.getIndustrialConf().deliveryManConf,
-            selfReference,
+            *this,
             conf.getIndustrialConf().producedItemConf,
             1
         );
@@ -1,12 +1,10 @@
 #ifndef INDUSTRIALBUILDING_HPP
 #define INDUSTRIALBUILDING_HPP
 
-#include <QtCore/QWeakPointer>
-
+#include "src/engine/map/dynamicElement/CharacterGeneratorInterface.hpp"
 #include "src/engine/map/staticElement/building/AbstractStoringBuilding.hpp"
 
 class Character;
-class CharacterGeneratorInterface;
 
 class IndustrialBuilding : public AbstractStoringBuilding
 {
@@ -25,6 +23,9 @@ class IndustrialBuilding : public AbstractStoringBuilding
         virtual void process(const CycleDate& date) override;
         virtual bool processInteraction(const CycleDate& date, Character& actor) override;
 
+        virtual void save(CitySnapshot& snapshot, CitySnapshot::Building& record) const override;
+        virtual void restore(const CitySnapshot& snapshot, const CitySnapshot::Building& record) override;
+
         virtual BuildingState getCurrentState() const override;
 
     protected:
@@ -45,7 +46,7 @@ class IndustrialBuilding : public AbstractStoringBuilding
         const int PRODUCTION_INTERVAL;
         CharacterGeneratorInterface& characterGenerator;
         int rawMaterialStock;
-        QWeakPointer<Character> deliveryMan;
+        CharacterHandle deliveryMan;
         int productionCountDown;
 };
 
@@ -4,7 +4,6 @@
 #include "src/engine/map/dynamicElement/character/WanderingCharacter.hpp"
 #include "src/engine/map/dynamicElement/CharacterGeneratorInterface.hpp"
 #include "src/global/conf/BuildingInformation.hpp"
-#include "src/global/pointer/SmartPointerUtils.hpp"
 
 
 
@@ -35,7 +34,6 @@ QSharedPointer<AbstractProcessableBuilding> LaboratoryBuilding::Create(
 ) {
     auto laboratory(new LaboratoryBuilding(characterFactory, conf, area, orientation, entryPointTile));
     QSharedPointer<AbstractProcessableBuilding> pointer(laboratory);
-    laboratory->selfReference = pointer;
 
     return pointer;
 }
@@ -59,7 +57,7 @@ void LaboratoryBuilding::process(const CycleDate& /*date*/)
 
     scientistGeneration.process(getCurrentWorkerQuantity());
     if (scientistGeneration.isReadyToGenerateWalker()) {
-        scientist = characterFactory.generateWanderingCharacter(conf.getLaboratoryConf().emittedScientist.conf, selfReference);
+        scientist = characterFactory.generateWanderingCharacter(conf.getLaboratoryConf().emittedScientist.conf, *this);
         scientistGeneration.reset();
     }
 }
@@ -68,7 +66,7 @@ void LaboratoryBuilding::process(const CycleDate& /*date*/)
 
 bool LaboratoryBuilding::processInteraction(const CycleDate& /*date*/, Character& actor)
 {
-    if (matches(scientist, actor)) {
+    if (actor.getHandle() == scientist) {
         scientist.clear();
 
         return true;
@@ -86,6 +84,25 @@ bool LaboratoryBuilding::processInteraction(const CycleDate& /*date*/, Character
 
 
 
+void LaboratoryBuilding::save(CitySnapshot& snapshot, CitySnapshot::Building& record) const
+{
+    AbstractProcessableBuilding::save(snapshot, record);
+    record.countDown = workingCountDown;
+    scientistGeneration.save(record);
+    record.character = scientist.pack();
+}
+
+
+
+void LaboratoryBuilding::restore(const CitySnapshot& /*snapshot*/, const CitySnapshot::Building& record)
+{
+    workingCountDown = record.countDown;
+    scientistGeneration.restore(record);
+    scientist = CharacterHandle::unpack(record.character);
+}
+
+
+
 BuildingStatus LaboratoryBuilding::getCurrentStatus() const
 {
     if (!isActive()) {
@@ -102,5 +119,5 @@ BuildingStatus LaboratoryBuilding::getCurrentStatus() const
 
 bool LaboratoryBuilding::canGenerateNewWalker() const
 {
-    return scientist.isNull();
+    return !characterFactory.isAlive(scientist);
 }
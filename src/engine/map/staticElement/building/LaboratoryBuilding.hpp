@@ -1,13 +1,11 @@
 #ifndef LABORATORYBUILDING_HPP
 #define LABORATORYBUILDING_HPP
 
-#include <QtCore/QWeakPointer>
-
+#include "src/engine/map/dynamicElement/CharacterGeneratorInterface.hpp"
 #include "src/engine/map/staticElement/building/behavior/WalkerGenerationBehavior.hpp"
 #include "src/engine/map/staticElement/building/AbstractProcessableBuilding.hpp"
 
 class Character;
-class CharacterGeneratorInterface;
 
 class LaboratoryBuilding : public AbstractProcessableBuilding
 {
@@ -15,7 +13,7 @@ class LaboratoryBuilding : public AbstractProcessableBuilding
         CharacterGeneratorInterface& characterFactory;
         int workingCountDown;
         WalkerGenerationBehavior scientistGeneration;
-        QWeakPointer<Character> scientist;
+        CharacterHandle scientist;
 
     private:
         LaboratoryBuilding(
@@ -38,6 +36,9 @@ class LaboratoryBuilding : public AbstractProcessableBuilding
         virtual void process(const CycleDate& date) override;
         virtual bool processInteraction(const CycleDate& date, Character& actor) override;
 
+        virtual void save(CitySnapshot& snapshot, CitySnapshot::Building& record) const override;
+        virtual void restore(const CitySnapshot& snapshot, const CitySnapshot::Building& record) override;
+
     protected:
         virtual BuildingStatus getCurrentStatus() const override;
 
@@ -7,7 +7,6 @@
 #include "src/engine/map/path/PathInterface.hpp"
 #include "src/engine/map/staticElement/natureElement/NatureElementSearchEngine.hpp"
 #include "src/global/conf/BuildingInformation.hpp"
-#include "src/global/pointer/SmartPointerUtils.hpp"
 #include "src/global/state/BuildingState.hpp"
 
 
@@ -22,7 +21,6 @@ QSharedPointer<AbstractProcessableBuilding> ProducerBuilding::Create(
 ) {
     auto producer(new ProducerBuilding(searchEngine, characterFactory, conf, area, orientation, entryPointTile));
     QSharedPointer<AbstractProcessableBuilding> pointer(producer);
-    producer->selfReference = pointer;
 
     return pointer;
 }
@@ -35,7 +33,7 @@ void ProducerBuilding::process(const CycleDate& /*date*/)
         return;
     }
 
-    cleanInvalids(miners);
+    cleanMiners();
     handleMinerGeneration();
 
     if (rawMaterialStock >= conf.getProducerConf().requiredQuantityForProduction) {
@@ -53,15 +51,14 @@ void ProducerBuilding::process(const CycleDate& /*date*/)
 
 bool ProducerBuilding::processInteraction(const CycleDate& /*date*/, Character& actor)
 {
-    if (matches(deliveryMan, actor)) {
+    if (actor.getHandle() == deliveryMan) {
         deliveryMan.clear();
 
         return true;
     }
 
-    if (miners.contains(&actor)) {
+    if (miners.removeOne(actor.getHandle())) {
         rawMaterialStock += conf.getProducerConf().miningQuantity;
-        miners.remove(&actor);
         notifyViewDataChange();
 
         return true;
@@ -72,10 +69,40 @@ bool ProducerBuilding::processInteraction(const CycleDate& /*date*/, Character&
 
 
 
+void ProducerBuilding::save(CitySnapshot& snapshot, CitySnapshot::Building& record) const
+{
+    AbstractProcessableBuilding::save(snapshot, record);
+    minerGeneration.save(record);
+    record.firstValue = snapshot.values.size();
+    record.valueCount = miners.size();
+    for (auto& miner : miners) {
+        snapshot.values.append(miner.pack());
+    }
+    record.quantity = rawMaterialStock;
+    record.character = deliveryMan.pack();
+    record.countDown = productionCountDown;
+}
+
+
+
+void ProducerBuilding::restore(const CitySnapshot& snapshot, const CitySnapshot::Building& record)
+{
+    minerGeneration.restore(record);
+    miners.clear();
+    for (int i(0); i < record.valueCount; ++i) {
+        miners.append(CharacterHandle::unpack(snapshot.values.at(record.firstValue + i)));
+    }
+    rawMaterialStock = record.quantity;
+    deliveryMan = CharacterHandle::unpack(record.character);
+    productionCountDown = record.countDown;
+}
+
+
+
 BuildingState ProducerBuilding::getCurrentState() const
 {
     return BuildingState::CreateProducerState(
-        reinterpret_cast<qintptr>(this),
+        getId(),
         conf,
         area,
         orientation,
@@ -139,8 +166,8 @@ void ProducerBuilding::handleMinerGeneration()
     if (minerGeneration.isReadyToGenerateWalker()) {
         auto path(searchEngine.getPathToClosestNaturalResource(conf.getProducerConf().rawMaterialConf, getEntryPointTile()));
         if (path) {
-            auto miner(characterFactory.generateMiner(conf.getProducerConf().miner.conf, selfReference, path));
-            miners.insert(miner.toStrongRef().get(), miner);
+            auto miner(characterFactory.generateMiner(conf.getProducerConf().miner.conf, *this, path));
+            miners.append(miner);
             minerGeneration.reset();
         }
         else {
@@ -151,6 +178,21 @@ void ProducerBuilding::handleMinerGeneration()
 
 
 
+void ProducerBuilding::cleanMiners()
+{
+    auto iterator(miners.begin());
+    while (iterator != miners.end()) {
+        if (!characterFactory.isAlive(*iterator)) {
+            iterator = miners.erase(iterator);
+        }
+        else {
+            ++iterator;
+        }
+    }
+}
+
+
+
 bool ProducerBuilding::canGenerateNewMiner() const
 {
     if (miners.size() >= conf.getProducerConf().miner.maxSimultaneous) {
@@ -169,10 +211,10 @@ bool ProducerBuilding::canGenerateNewMiner() const
 
 void ProducerBuilding::handleProduction()
 {
-    if (!deliveryMan) {
+    if (!characterFactory.isAlive(deliveryMan)) {
         deliveryMan = characterFactory.generateDeliveryMan(
             conf.getProducerConf().deliveryManConf,
-            selfReference,
+            *this,
             conf.getProducerConf().producedItemConf,
             1
         );
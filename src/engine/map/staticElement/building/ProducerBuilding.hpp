@@ -1,16 +1,15 @@
 #ifndef PRODUCERBUILDING_HPP
 #define PRODUCERBUILDING_HPP
 
-#include <QtCore/QHash>
-#include <QtCore/QWeakPointer>
+#include <QtCore/QList>
 
+#include "src/engine/map/dynamicElement/CharacterGeneratorInterface.hpp"
 #include "src/engine/map/staticElement/building/behavior/WalkerGenerationBehavior.hpp"
 #include "src/engine/map/staticElement/building/AbstractProcessableBuilding.hpp"
 #include "src/engine/processing/CycleDate.hpp"
 #include "src/global/BuildingStatus.hpp"
 
 class Character;
-class CharacterGeneratorInterface;
 class NatureElementSearchEngine;
 
 class ProducerBuilding : public AbstractProcessableBuilding
@@ -28,6 +27,9 @@ class ProducerBuilding : public AbstractProcessableBuilding
         virtual void process(const CycleDate& date) override;
         virtual bool processInteraction(const CycleDate& date, Character& actor) override;
 
+        virtual void save(CitySnapshot& snapshot, CitySnapshot::Building& record) const override;
+        virtual void restore(const CitySnapshot& snapshot, const CitySnapshot::Building& record) override;
+
         virtual BuildingState getCurrentState() const override;
 
     protected:
@@ -43,6 +45,11 @@ class ProducerBuilding : public AbstractProcessableBuilding
             const Tile& entryPointTile
         );
 
+        /**
+         * @brief Forget the miners that are not on the map anymore.
+         */
+        void cleanMiners();
+
         void handleMinerGeneration();
 
         /**
@@ -57,9 +64,9 @@ class ProducerBuilding : public AbstractProcessableBuilding
         const NatureElementSearchEngine& searchEngine;
         CharacterGeneratorInterface& characterFactory;
         WalkerGenerationBehavior minerGeneration;
-        QHash<Character*, QWeakPointer<Character>> miners;
+        QList<CharacterHandle> miners;
         int rawMaterialStock;
-        QWeakPointer<Character> deliveryMan;
+        CharacterHandle deliveryMan;
         int productionCountDown;
 };
 
@@ -3,7 +3,6 @@
 #include "src/engine/map/dynamicElement/character/WanderingCharacter.hpp"
 #include "src/engine/map/dynamicElement/CharacterGeneratorInterface.hpp"
 #include "src/global/conf/BuildingInformation.hpp"
-#include "src/global/pointer/SmartPointerUtils.hpp"
 
 
 
@@ -33,7 +32,6 @@ QSharedPointer<AbstractProcessableBuilding> SanityBuilding::Create(
 ) {
     auto sanity(new SanityBuilding(characterFactory, conf, area, orientation, entryPointTile));
     QSharedPointer<AbstractProcessableBuilding> pointer(sanity);
-    sanity->selfReference = pointer;
 
     return pointer;
 }
@@ -52,7 +50,7 @@ void SanityBuilding::process(const CycleDate& /*date*/)
 
     walkerGeneration.process(getCurrentWorkerQuantity());
     if (walkerGeneration.isReadyToGenerateWalker()) {
-        walker = characterFactory.generateWanderingCharacter(conf.getSanityConf().walker.conf, selfReference);
+        walker = characterFactory.generateWanderingCharacter(conf.getSanityConf().walker.conf, *this);
         walkerGeneration.reset();
     }
 }
@@ -61,7 +59,7 @@ void SanityBuilding::process(const CycleDate& /*date*/)
 
 bool SanityBuilding::processInteraction(const CycleDate& /*date*/, Character& actor)
 {
-    if (matches(walker, actor)) {
+    if (actor.getHandle() == walker) {
         walker.clear();
 
         return true;
@@ -72,7 +70,24 @@ bool SanityBuilding::processInteraction(const CycleDate& /*date*/, Character& ac
 
 
 
+void SanityBuilding::save(CitySnapshot& snapshot, CitySnapshot::Building& record) const
+{
+    AbstractProcessableBuilding::save(snapshot, record);
+    walkerGeneration.save(record);
+    record.character = walker.pack();
+}
+
+
+
+void SanityBuilding::restore(const CitySnapshot& /*snapshot*/, const CitySnapshot::Building& record)
+{
+    walkerGeneration.restore(record);
+    walker = CharacterHandle::unpack(record.character);
+}
+
+
+
 bool SanityBuilding::canGenerateNewWalker() const
 {
-    return walker.isNull();
+    return !characterFactory.isAlive(walker);
 }
@@ -3,19 +3,19 @@
 
 #include <QtCore/QSharedPointer>
 
+#include "src/engine/map/dynamicElement/CharacterGeneratorInterface.hpp"
 #include "src/engine/map/staticElement/building/behavior/WalkerGenerationBehavior.hpp"
 #include "src/engine/map/staticElement/building/AbstractProcessableBuilding.hpp"
 #include "src/engine/processing/CycleDate.hpp"
 
 class Character;
-class CharacterGeneratorInterface;
 
 class SanityBuilding : public AbstractProcessableBuilding
 {
     private:
         CharacterGeneratorInterface& characterFactory;
         WalkerGenerationBehavior walkerGeneration;
-        QWeakPointer<Character> walker;
+        CharacterHandle walker;
 
     private:
         SanityBuilding(
@@ -38,6 +38,9 @@ class SanityBuilding : public AbstractProcessableBuilding
         virtual void process(const CycleDate& date) override;
         virtual bool processInteraction(const CycleDate& date, Character& actor) override;
 
+        virtual void save(CitySnapshot& snapshot, CitySnapshot::Building& record) const override;
+        virtual void restore(const CitySnapshot& snapshot, const CitySnapshot::Building& record) override;
+
     private:
         /**
          * @brief Indicate if a new walker can be generated.
@@ -36,7 +36,6 @@ QSharedPointer<AbstractProcessableBuilding> SchoolBuilding::Create(
 ) {
     auto school(new SchoolBuilding(searchEngine, characterFactory, conf, area, orientation, entryPointTile));
     QSharedPointer<AbstractProcessableBuilding> pointer(school);
-    school->selfReference = pointer;
 
     return pointer;
 }
@@ -53,7 +52,7 @@ void SchoolBuilding::process(const CycleDate& /*date*/)
     if (walkerGeneration.isReadyToGenerateWalker()) {
         auto target(searchEngine.findClosestBuilding(conf.getSchoolConf().targetLaboratory, getEntryPointTile()));
         if (target) {
-            characterFactory.generateStudent(conf.getSchoolConf().student.conf, selfReference, target);
+            characterFactory.generateStudent(conf.getSchoolConf().student.conf, *this, *target);
             walkerGeneration.reset();
         }
         else {
@@ -61,3 +60,18 @@ void SchoolBuilding::process(const CycleDate& /*date*/)
         }
     }
 }
+
+
+
+void SchoolBuilding::save(CitySnapshot& snapshot, CitySnapshot::Building& record) const
+{
+    AbstractProcessableBuilding::save(snapshot, record);
+    walkerGeneration.save(record);
+}
+
+
+
+void SchoolBuilding::restore(const CitySnapshot& /*snapshot*/, const CitySnapshot::Building& record)
+{
+    walkerGeneration.restore(record);
+}
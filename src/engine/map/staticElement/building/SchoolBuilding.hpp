@@ -40,6 +40,9 @@ class SchoolBuilding : public AbstractProcessableBuilding
         );
 
         virtual void process(const CycleDate& date) override;
+
+        virtual void save(CitySnapshot& snapshot, CitySnapshot::Building& record) const override;
+        virtual void restore(const CitySnapshot& snapshot, const CitySnapshot::Building& record) override;
 };
 
 #endif // SCHOOLBUILDING_HPP
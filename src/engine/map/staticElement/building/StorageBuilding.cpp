@@ -4,6 +4,7 @@
 
 #include "src/engine/map/dynamicElement/character/DeliveryManCharacter.hpp"
 #include "src/global/conf/BuildingInformation.hpp"
+#include "src/global/conf/ItemInformation.hpp"
 #include "src/global/state/BuildingState.hpp"
 
 
@@ -30,7 +31,6 @@ QSharedPointer<AbstractStoringBuilding> StorageBuilding::Create(
 ) {
     auto storage(new StorageBuilding(conf, area, orientation, entryPointTile));
     QSharedPointer<AbstractStoringBuilding> pointer(storage);
-    storage->selfReference = pointer;
 
     return pointer;
 }
@@ -65,7 +65,7 @@ void StorageBuilding::process(const CycleDate& /*date*/)
 
 bool StorageBuilding::processInteraction(const CycleDate& /*date*/, Character& actor)
 {
-    auto deliveryMan(dynamic_cast<DeliveryManCharacter*>(&actor));
+    auto deliveryMan(actor.castTo<DeliveryManCharacter>());
     if (deliveryMan) {
         auto& item(deliveryMan->getTransportedItemConf());
         auto quantity(qMin(storableQuantity(item), deliveryMan->getTransportedQuantity()));
@@ -82,10 +82,32 @@ bool StorageBuilding::processInteraction(const CycleDate& /*date*/, Character& a
 
 
 
+void StorageBuilding::save(CitySnapshot& snapshot, CitySnapshot::Building& record) const
+{
+    AbstractStoringBuilding::save(snapshot, record);
+    // The stock of each item type, in the order of the item keys of the snapshot.
+    record.firstValue = snapshot.values.size();
+    record.valueCount = snapshot.itemKeys.size();
+    for (int i(0); i < record.valueCount; ++i) {
+        snapshot.values.append(stock[i]);
+    }
+}
+
+
+
+void StorageBuilding::restore(const CitySnapshot& snapshot, const CitySnapshot::Building& record)
+{
+    for (int i(0); i < record.valueCount && i < MAX_ITEM_TYPES; ++i) {
+        stock[i] = snapshot.values.at(record.firstValue + i);
+    }
+}
+
+
+
 BuildingState StorageBuilding::getCurrentState() const
 {
     return BuildingState::CreateStorageState(
-        reinterpret_cast<qintptr>(this),
+        getId(),
         conf,
         area,
         orientation,
@@ -100,5 +122,5 @@ BuildingState StorageBuilding::getCurrentState() const
 
 void StorageBuilding::store(const ItemInformation& itemConf, const int quantity)
 {
-    stock[&itemConf] += quantity;
+    stock[itemConf.getIndex()] += quantity;
 }
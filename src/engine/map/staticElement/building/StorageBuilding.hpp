@@ -1,16 +1,15 @@
 #ifndef STORAGEBUILDING_HPP
 #define STORAGEBUILDING_HPP
 
-#include <QtCore/QHash>
-
 #include "src/engine/map/staticElement/building/AbstractStoringBuilding.hpp"
+#include "src/defines.hpp"
 
 class ItemInformation;
 
 class StorageBuilding : public AbstractStoringBuilding
 {
     private:
-        QHash<const ItemInformation*, int> stock;
+        int stock[MAX_ITEM_TYPES]; ///< The stored quantity of each item type, indexed by ItemInformation::getIndex().
 
     private:
         StorageBuilding(
@@ -34,6 +33,9 @@ class StorageBuilding : public AbstractStoringBuilding
         virtual void process(const CycleDate& date) override;
         virtual bool processInteraction(const CycleDate& date, Character& actor) override;
 
+        virtual void save(CitySnapshot& snapshot, CitySnapshot::Building& record) const override;
+        virtual void restore(const CitySnapshot& snapshot, const CitySnapshot::Building& record) override;
+
         virtual BuildingState getCurrentState() const override;
 
     private:
@@ -45,3 +45,17 @@ void WalkerGenerationBehavior::reset()
 {
     generationCountDown = GENERATION_INTERVAL;
 }
+
+
+
+void WalkerGenerationBehavior::save(CitySnapshot::Building& record) const
+{
+    record.generationCountDown = generationCountDown;
+}
+
+
+
+void WalkerGenerationBehavior::restore(const CitySnapshot::Building& record)
+{
+    generationCountDown = record.generationCountDown;
+}
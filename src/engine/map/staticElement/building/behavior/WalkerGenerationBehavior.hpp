@@ -1,6 +1,8 @@
 #ifndef WALKERGENERATIONBEHAVIOR_HPP
 #define WALKERGENERATIONBEHAVIOR_HPP
 
+#include "src/engine/loader/CitySnapshot.hpp"
+
 /**
  * @brief Handles the walker generation logic for a building.
  */
@@ -19,6 +21,9 @@ class WalkerGenerationBehavior
         void process(int currentWorkers);
         void postpone();
         void reset();
+
+        void save(CitySnapshot::Building& record) const;
+        void restore(const CitySnapshot::Building& record);
 };
 
 #endif // WALKERGENERATIONBEHAVIOR_HPP
@@ -5,7 +5,7 @@
 
 
 NatureElement::NatureElement(const NatureElementInformation& conf, const TileArea& area) :
-    AbstractStaticElement(),
+    AbstractStaticElement(KIND),
     conf(conf),
     area(area),
     busy(false)
@@ -50,7 +50,15 @@ bool NatureElement::isBusy() const
 
 
 
+quint64 NatureElement::getId() const
+{
+    // Nature elements are never destroyed, so their address is never reused by another one.
+    return reinterpret_cast<quintptr>(this);
+}
+
+
+
 NatureElementState NatureElement::getState() const
 {
-    return { reinterpret_cast<qintptr>(this), conf, area };
+    return { getId(), conf, area };
 }
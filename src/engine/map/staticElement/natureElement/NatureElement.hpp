@@ -11,6 +11,9 @@ struct NatureElementState;
 
 class NatureElement : public AbstractStaticElement
 {
+    public:
+        static constexpr Kind KIND = Kind::NatureElement;
+
     public:
         NatureElement(const NatureElementInformation& conf, const TileArea& area);
 
@@ -21,6 +24,10 @@ class NatureElement : public AbstractStaticElement
         void endInteraction();
         bool isBusy() const;
 
+        /**
+         * @brief Get the ID identifying the nature element in its state and in the state deltas.
+         */
+        quint64 getId() const;
         NatureElementState getState() const;
 
     private:
@@ -25,7 +25,7 @@ void NatureElementSearchEngine::registerNaturalResource(const QSharedPointer<Nat
 
     auto& naturalRessources(availableNaturalResources[&conf]);
     for (auto coordinates : naturalResource->getArea()) {
-        naturalRessources.insert(coordinates.hash(), naturalResource);
+        naturalRessources.insert(coordinates, naturalResource);
     }
 }
 
@@ -50,7 +50,7 @@ QSharedPointer<PathInterface> NatureElementSearchEngine::getPathToClosestNatural
     return pathGenerator.generateShortestPathToClosestMatch(
         origin,
         [&coordinatesSet](const Tile& tile) -> QWeakPointer<AbstractStaticElement> {
-            auto naturalResource(coordinatesSet.value(tile.coordinates().hash()).toStrongRef());
+            auto naturalResource(coordinatesSet.value(tile.coordinates()).toStrongRef());
             if (naturalResource.isNull() || naturalResource->isBusy()) {
                 return {};
             }
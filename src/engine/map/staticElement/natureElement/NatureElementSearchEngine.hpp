@@ -3,9 +3,9 @@
 
 #include <QtCore/QHash>
 #include <QtCore/QSharedPointer>
-#include <QtCore/QString>
 #include <QtCore/QWeakPointer>
 
+#include "src/global/geometry/TileCoordinates.hpp"
 #include "src/defines.hpp"
 
 class NatureElement;
@@ -15,7 +15,7 @@ class PathInterface;
 class Tile;
 class TileArea;
 
-using NaturalResourceElements = QHash<QString, QWeakPointer<NatureElement>>;
+using NaturalResourceElements = QHash<TileCoordinates, QWeakPointer<NatureElement>>;
 
 class NatureElementSearchEngine
 {
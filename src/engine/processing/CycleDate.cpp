@@ -282,6 +282,13 @@ int CycleDate::getMonth() const
 
 
 
+int CycleDate::getCycles() const
+{
+    return cycles;
+}
+
+
+
 bool CycleDate::isFirstCycleOfMonth() const
 {
     return cycles == 0;
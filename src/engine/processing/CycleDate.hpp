@@ -100,6 +100,7 @@ class CycleDate
 
         int getYear() const;
         int getMonth() const;
+        int getCycles() const;
         bool isFirstCycleOfMonth() const;
         bool isBuildingCycle() const;
 
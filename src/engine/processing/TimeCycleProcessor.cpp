@@ -31,7 +31,6 @@ TimeCycleProcessor::TimeCycleProcessor(const CycleDate& startingDate,
     if (speedRatio > 2.0) {
         this->speedRatio = 2.0;
     }
-    clock.start(MSEC_PER_SEC / (CYCLES_PER_SECOND * this->speedRatio), this);
 }
 
 
@@ -95,6 +94,15 @@ void TimeCycleProcessor::forceNextProcess()
 
 
 
+void TimeCycleProcessor::processCycles(const int quantity)
+{
+    for (int i(0); i < quantity; ++i) {
+        processCycle();
+    }
+}
+
+
+
 void TimeCycleProcessor::timerEvent(QTimerEvent* /*event*/)
 {
     processCycle();
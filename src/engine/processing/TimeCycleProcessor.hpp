@@ -17,6 +17,9 @@ class Character;
  * (AbstractProcessable). The normal speed (100%) implies 30 cycles per second. The speed can be lower down to 10%
  * (then, only 3 cycles are processed each seconds).
  *
+ * The processor starts paused and its clock only runs once it is resumed. This allows an headless host to drive the
+ * processing with processCycles() from any thread.
+ *
  * @todo A no-limit speed could be eventually set, making the next cycle to begin as soon as the current cycle ends.
  */
 class TimeCycleProcessor : public QObject
@@ -58,6 +61,14 @@ class TimeCycleProcessor : public QObject
          */
         void forceNextProcess();
 
+        /**
+         * @brief Synchronously process the given quantity of cycles.
+         *
+         * This is meant for headless simulations, where the caller owns the clock: the cycles are always processed,
+         * so the processor must not be resumed meanwhile, or its own clock would process cycles concurrently.
+         */
+        void processCycles(const int quantity);
+
     signals:
         /**
          * @brief Indicate when a cycle process is finished.
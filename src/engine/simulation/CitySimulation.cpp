@@ -0,0 +1,161 @@
+#include "CitySimulation.hpp"
+
+#include <QtCore/QSemaphore>
+#include <QtCore/QThread>
+
+/**
+ * The maximum quantity of pending commands. The GUI waits for the simulation thread to catch up beyond that.
+ */
+const int COMMAND_QUEUE_CAPACITY(1024);
+
+
+
+CitySimulation::CitySimulation(const Conf& conf, CityLoader& loader) :
+    QObject(),
+    stateJournal(),
+    city(conf, loader),
+    mapState(city.getMapState()),
+    initialState(city.getCurrentState(), city.getNatureElementsState(), city.getBuildingsState(), city.getCharactersState()),
+    acknowledgedVersion(-1),
+    minimumAcknowledgedVersion(0),
+    commands(COMMAND_QUEUE_CAPACITY),
+    wakeUpPending(0),
+    stateDeltas()
+{
+    city.attachStateJournal(stateJournal);
+    connect(&city.getProcessor(), &TimeCycleProcessor::processFinished, this, &CitySimulation::publishStateDelta);
+}
+
+
+
+CitySimulation::CitySimulation(const Conf& conf, const CitySnapshot& snapshot) :
+    QObject(),
+    stateJournal(),
+    city(conf, snapshot),
+    mapState(city.getMapState()),
+    initialState(city.getCurrentState(), city.getNatureElementsState(), city.getBuildingsState(), city.getCharactersState()),
+    acknowledgedVersion(-1),
+    minimumAcknowledgedVersion(0),
+    commands(COMMAND_QUEUE_CAPACITY),
+    wakeUpPending(0),
+    stateDeltas()
+{
+    city.attachStateJournal(stateJournal);
+    connect(&city.getProcessor(), &TimeCycleProcessor::processFinished, this, &CitySimulation::publishStateDelta);
+}
+
+
+
+void CitySimulation::moveTo(QThread& thread)
+{
+    moveToThread(&thread);
+    city.getProcessor().moveToThread(&thread);
+}
+
+
+
+City& CitySimulation::getCity()
+{
+    return city;
+}
+
+
+
+void CitySimulation::acknowledgeState(const int version)
+{
+    if (version < minimumAcknowledgedVersion) {
+        return;
+    }
+
+    acknowledgedVersion = version;
+    stateJournal.acknowledge(version);
+}
+
+
+
+void CitySimulation::requestFullResync()
+{
+    acknowledgedVersion = -1;
+    minimumAcknowledgedVersion = stateJournal.getVersion() + 1;
+}
+
+
+
+const MapState& CitySimulation::getMapState() const
+{
+    return mapState;
+}
+
+
+
+const State& CitySimulation::getInitialState() const
+{
+    return initialState;
+}
+
+
+
+void CitySimulation::sendCommand(Command&& command)
+{
+    while (!commands.push(std::move(command))) {
+        QThread::yieldCurrentThread();
+    }
+
+    // Only one wake up request is pending at a time, whatever the quantity of commands sent meanwhile.
+    if (wakeUpPending.testAndSetOrdered(0, 1)) {
+        QMetaObject::invokeMethod(this, [this]() { processCommands(); }, Qt::QueuedConnection);
+    }
+}
+
+
+
+void CitySimulation::sendCommandAndWait(Command&& command)
+{
+    QSemaphore done;
+    sendCommand([&command, &done](CitySimulation& simulation) {
+        command(simulation);
+        done.release();
+    });
+    done.acquire();
+}
+
+
+
+bool CitySimulation::updateStateDelta()
+{
+    return stateDeltas.update();
+}
+
+
+
+const StateDelta& CitySimulation::getStateDelta() const
+{
+    return *stateDeltas.getFrontBuffer();
+}
+
+
+
+void CitySimulation::processCommands()
+{
+    // The flag is reset first: a command sent while processing will either be processed now or trigger a new wake up.
+    // The reset must be a full barrier: a release store could be reordered after the first pop, which could then miss
+    // a command pushed right before the sender found the flag still set.
+    wakeUpPending.fetchAndStoreOrdered(0);
+
+    Command command;
+    while (commands.pop(command)) {
+        command(*this);
+    }
+}
+
+
+
+void CitySimulation::publishStateDelta()
+{
+    stateJournal.publish();
+
+    stateDeltas.getBackBuffer() = QSharedPointer<const StateDelta>(
+        new StateDelta(stateJournal.getDelta(acknowledgedVersion, city.getCurrentState()))
+    );
+    stateDeltas.publish();
+}
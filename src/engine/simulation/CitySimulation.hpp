@@ -0,0 +1,114 @@
+#ifndef CITYSIMULATION_HPP
+#define CITYSIMULATION_HPP
+
+#include <functional>
+#include <QtCore/QAtomicInteger>
+#include <QtCore/QObject>
+#include <QtCore/QSharedPointer>
+
+#include "src/engine/city/City.hpp"
+#include "src/engine/StateJournal.hpp"
+#include "src/global/concurrency/SpscQueue.hpp"
+#include "src/global/concurrency/TripleBuffer.hpp"
+#include "src/global/state/MapState.hpp"
+#include "src/global/state/State.hpp"
+#include "src/global/state/StateDelta.hpp"
+
+class CityLoader;
+class Conf;
+class QThread;
+struct CitySnapshot;
+
+/**
+ * @brief A city simulated on its own thread, driven from the GUI thread.
+ *
+ * Once started, the city, its time-cycle processor and its state journal are only touched by the simulation thread. The
+ * GUI thread communicates with it through two lock-free channels:
+ *  - the commands (pause, speed, building creation, queries...) are pushed into a single-producer single-consumer
+ *    queue, then executed by the simulation thread in the order they were sent;
+ *  - after each cycle, the changes of the state since the last acknowledged version are published as an immutable
+ *    delta into a triple buffer, from which the GUI thread picks the latest one up whenever it is ready to display it.
+ *
+ * So the GUI never waits for a cycle to end, except for the few queries expecting an immediate answer.
+ */
+class CitySimulation : public QObject
+{
+        Q_OBJECT
+
+    public:
+        using Command = std::function<void(CitySimulation&)>;
+
+    private:
+        StateJournal stateJournal; ///< Must outlive the city, whose elements report their changes to it.
+        City city;
+        const MapState mapState;
+        const State initialState;
+        int acknowledgedVersion; ///< The last version of the state applied by the GUI.
+        int minimumAcknowledgedVersion; ///< Older acknowledgements are ignored, they were sent before a resync request.
+        SpscQueue<Command> commands;
+        QAtomicInt wakeUpPending; ///< Indicate the simulation thread has already been asked to process the commands.
+        TripleBuffer<QSharedPointer<const StateDelta>> stateDeltas;
+
+    public:
+        /**
+         * @brief Load the city, on the calling thread.
+         */
+        CitySimulation(const Conf& conf, CityLoader& loader);
+
+        /**
+         * @brief Restore a saved city, on the calling thread.
+         */
+        CitySimulation(const Conf& conf, const CitySnapshot& snapshot);
+
+        /**
+         * @brief Move the simulation to the given thread, where the commands will be executed and the cycles processed.
+         */
+        void moveTo(QThread& thread);
+
+        // Simulation thread only.
+        City& getCity();
+        void acknowledgeState(const int version);
+
+        /**
+         * @brief Make the next deltas full resyncs, until the GUI acknowledges one of them.
+         */
+        void requestFullResync();
+
+        // GUI thread only.
+        const MapState& getMapState() const;
+
+        /**
+         * @brief Get the state of the city when it was loaded.
+         */
+        const State& getInitialState() const;
+
+        /**
+         * @brief Queue a command to be executed by the simulation thread.
+         */
+        void sendCommand(Command&& command);
+
+        /**
+         * @brief Queue a command and wait for the simulation thread to execute it.
+         *
+         * This is meant for the queries expecting an immediate answer. It must never be called by the simulation thread.
+         */
+        void sendCommandAndWait(Command&& command);
+
+        /**
+         * @brief Pick the latest published delta up, if any.
+         *
+         * @return False if no delta has been published since the last call.
+         */
+        bool updateStateDelta();
+
+        /**
+         * @brief Get the latest delta picked up by updateStateDelta().
+         */
+        const StateDelta& getStateDelta() const;
+
+    private:
+        void processCommands();
+        void publishStateDelta();
+};
+
+#endif // CITYSIMULATION_HPP
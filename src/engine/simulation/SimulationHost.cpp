@@ -0,0 +1,159 @@
+#include "SimulationHost.hpp"
+
+#include <exception>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QRunnable>
+
+#include "src/engine/city/City.hpp"
+#include "src/engine/loader/CityLoader.hpp"
+#include "src/engine/loader/CitySnapshot.hpp"
+#include "src/defines.hpp"
+
+/**
+ * The quantity of cycles a task processes on a city before handing over to the next pending slice.
+ */
+const int CYCLES_PER_SLICE(CYCLES_PER_SECOND * 10);
+const qreal MSEC_PER_SEC(1000);
+const qint64 NSEC_PER_MSEC(1000000);
+
+
+
+/**
+ * @brief The simulation of a single city, processed slice by slice on the thread pool.
+ *
+ * The task re-schedules itself at the end of each slice. Since a new slice is only scheduled once the previous one is
+ * over, a city is never processed by two threads at the same time.
+ */
+class CitySimulationTask : public QRunnable
+{
+    private:
+        const Conf& conf;
+        QThreadPool& pool;
+        SimulationHost::CityReport& report;
+        const int cycleQuantity;
+        optional<owner<City*>> city;
+        qint64 processingTime;
+
+    public:
+        CitySimulationTask(const Conf& conf, QThreadPool& pool, SimulationHost::CityReport& report, const int cycleQuantity) :
+            QRunnable(),
+            conf(conf),
+            pool(pool),
+            report(report),
+            cycleQuantity(cycleQuantity),
+            city(nullptr),
+            processingTime(0)
+        {
+            setAutoDelete(false);
+        }
+
+        ~CitySimulationTask()
+        {
+            if (city) {
+                delete city;
+            }
+        }
+
+        virtual void run() override
+        {
+            if (!city && !load()) {
+                return;
+            }
+
+            auto slice(qMin(CYCLES_PER_SLICE, cycleQuantity - report.processedCycles));
+            QElapsedTimer timer;
+            timer.start();
+            try {
+                city->getProcessor().processCycles(slice);
+                report.processedCycles += slice;
+            }
+            catch (const std::exception& exception) {
+                report.error = exception.what();
+            }
+            processingTime += timer.nsecsElapsed();
+            report.processingTime = processingTime / NSEC_PER_MSEC;
+
+            if (report.error.isEmpty() && report.processedCycles < cycleQuantity) {
+                // Nothing must be done after this call: the next slice may already be running on another thread.
+                pool.start(this);
+            }
+        }
+
+    private:
+        bool load()
+        {
+            QElapsedTimer timer;
+            timer.start();
+            try {
+                if (CitySnapshot::isSnapshot(report.cityFilePath)) {
+                    city = new City(conf, CitySnapshot::load(report.cityFilePath));
+                }
+                else {
+                    CityLoader loader(report.cityFilePath);
+                    city = new City(conf, loader);
+                }
+                report.title = city->getTitle();
+            }
+            catch (const std::exception& exception) {
+                report.error = exception.what();
+            }
+            report.loadingTime = timer.elapsed();
+
+            return city != nullptr;
+        }
+};
+
+
+
+qreal SimulationHost::CityReport::getCyclesPerSecond() const
+{
+    if (processingTime <= 0) {
+        return 0.0;
+    }
+
+    return processedCycles * (MSEC_PER_SEC / processingTime);
+}
+
+
+
+SimulationHost::SimulationHost(const Conf& conf, const int maxThreadCount) :
+    conf(conf),
+    pool(),
+    cityFilePaths()
+{
+    if (maxThreadCount > 0) {
+        pool.setMaxThreadCount(maxThreadCount);
+    }
+}
+
+
+
+void SimulationHost::addCity(const QString& cityFilePath)
+{
+    cityFilePaths.append(cityFilePath);
+}
+
+
+
+QList<SimulationHost::CityReport> SimulationHost::run(const int cycleQuantity)
+{
+    // Reports are created before any task starts, so the tasks can safely keep a reference on their own report.
+    QList<CityReport> reports;
+    reports.reserve(cityFilePaths.size());
+    for (auto cityFilePath : cityFilePaths) {
+        reports.append({ cityFilePath, QString(), 0, 0, 0, QString() });
+    }
+
+    QList<CitySimulationTask*> tasks;
+    for (auto& report : reports) {
+        tasks.append(new CitySimulationTask(conf, pool, report, cycleQuantity));
+    }
+    for (auto task : tasks) {
+        pool.start(task);
+    }
+
+    pool.waitForDone();
+    qDeleteAll(tasks);
+
+    return reports;
+}
@@ -0,0 +1,60 @@
+#ifndef SIMULATIONHOST_HPP
+#define SIMULATIONHOST_HPP
+
+#include <QtCore/QList>
+#include <QtCore/QString>
+#include <QtCore/QThreadPool>
+
+class Conf;
+
+/**
+ * @brief Runs many independent cities concurrently, without any viewer.
+ *
+ * Each city is loaded from its own city file and processed in headless mode: its time-cycle processor is never resumed
+ * and the cycles are processed back to back. The processing of a city is split into slices of cycles. Each slice is a
+ * task of a shared thread pool that re-schedules the next slice when it ends, so an idle thread always picks the next
+ * pending slice of any city and long-running cities do not hold the other threads back.
+ *
+ * The cities do not share any mutable state, the configuration is only read.
+ */
+class SimulationHost
+{
+    public:
+        struct CityReport {
+            QString cityFilePath;
+            QString title;
+            int processedCycles;
+            qint64 loadingTime;    ///< The time spent to load the city, in milliseconds.
+            qint64 processingTime; ///< The time spent to process the cycles, in milliseconds.
+            QString error;         ///< Empty if the simulation succeeded.
+
+            /**
+             * @brief The throughput of the simulation, in processed cycles per second.
+             */
+            qreal getCyclesPerSecond() const;
+        };
+
+    private:
+        const Conf& conf;
+        QThreadPool pool;
+        QList<QString> cityFilePaths;
+
+    public:
+        /**
+         * @param conf           The game configuration, shared by all the cities.
+         * @param maxThreadCount The maximum quantity of threads to use. Defaults to the quantity of CPU cores.
+         */
+        SimulationHost(const Conf& conf, const int maxThreadCount = 0);
+
+        void addCity(const QString& cityFilePath);
+
+        /**
+         * @brief Process the given quantity of cycles on each city, then report the throughput of each city.
+         *
+         * This method blocks until all the cities have been processed. The reports are in the same order than the
+         * added cities.
+         */
+        QList<CityReport> run(const int cycleQuantity);
+};
+
+#endif // SIMULATIONHOST_HPP
@@ -0,0 +1,99 @@
+#ifndef SPSCQUEUE_HPP
+#define SPSCQUEUE_HPP
+
+#include <utility>
+#include <QtCore/QAtomicInteger>
+#include <QtCore/QVector>
+
+#include "src/defines.hpp"
+
+/**
+ * @brief A bounded, lock-free queue between a single producer thread and a single consumer thread.
+ *
+ * The items are kept in a ring buffer whose capacity is rounded up to a power of two. The producer only writes the tail
+ * and the consumer only writes the head, so neither side ever waits for the other: pushing into a full queue or popping
+ * from an empty queue simply fails.
+ *
+ * Only one thread may push and only one thread may pop at a time.
+ */
+template<class T>
+class SpscQueue
+{
+        Q_DISABLE_COPY_MOVE(SpscQueue)
+
+    private:
+        static constexpr int CACHE_LINE_SIZE = 64;
+
+        QVector<T> items;
+        T* const buffer; ///< The data of `items`, accessed without going through the implicit sharing of QVector.
+        const quint32 mask;
+        alignas(CACHE_LINE_SIZE) QAtomicInteger<quint32> head; ///< The index of the next item to pop, written by the consumer.
+        alignas(CACHE_LINE_SIZE) QAtomicInteger<quint32> tail; ///< The index of the next item to push, written by the producer.
+
+    public:
+        explicit SpscQueue(const int capacity) :
+            items(roundUpToPowerOfTwo(capacity)),
+            buffer(items.data()),
+            mask(items.size() - 1),
+            head(0),
+            tail(0)
+        {
+
+        }
+
+        /**
+         * @brief Push an item at the end of the queue. Must only be called by the producer.
+         *
+         * @return False if the queue is full, the item is then left untouched.
+         */
+        bool push(T&& item)
+        {
+            auto currentTail(tail.loadRelaxed());
+            if (currentTail - head.loadAcquire() > mask) {
+                return false;
+            }
+
+            buffer[currentTail & mask] = std::move(item);
+            tail.storeRelease(currentTail + 1);
+
+            return true;
+        }
+
+        /**
+         * @brief Pop the first item of the queue. Must only be called by the consumer.
+         *
+         * @return False if the queue is empty.
+         */
+        bool pop(T& item)
+        {
+            auto currentHead(head.loadRelaxed());
+            if (currentHead == tail.loadAcquire()) {
+                return false;
+            }
+
+            // The slot is reset so that the queue does not keep any resource of a popped item alive.
+            item = std::move(buffer[currentHead & mask]);
+            buffer[currentHead & mask] = T();
+            head.storeRelease(currentHead + 1);
+
+            return true;
+        }
+
+        int getCapacity() const
+        {
+            return items.size();
+        }
+
+    private:
+        static int roundUpToPowerOfTwo(const int capacity)
+        {
+            int roundedCapacity(1);
+            while (roundedCapacity < capacity) {
+                roundedCapacity *= 2;
+            }
+
+            return roundedCapacity;
+        }
+};
+
+#endif // SPSCQUEUE_HPP
@@ -0,0 +1,80 @@
+#ifndef TRIPLEBUFFER_HPP
+#define TRIPLEBUFFER_HPP
+
+#include <QtCore/QAtomicInteger>
+
+#include "src/defines.hpp"
+
+/**
+ * @brief Hands over the latest value written by a single writer thread to a single reader thread, without locking.
+ *
+ * The writer fills the back buffer and publishes it; the reader picks the latest published buffer up as its front
+ * buffer. A third buffer sits between them, so the writer never waits for the reader and the reader never sees a
+ * buffer being written. Values published while the reader did not update are skipped: only the latest one is read.
+ */
+template<class T>
+class TripleBuffer
+{
+        Q_DISABLE_COPY_MOVE(TripleBuffer)
+
+    private:
+        static constexpr int INDEX_MASK = 0x3;
+        static constexpr int FRESH_FLAG = 0x4; ///< Set on the middle buffer when it has been published since last read.
+
+        T buffers[3];
+        int backIndex;  ///< Only accessed by the writer.
+        QAtomicInt middleIndex;
+        int frontIndex; ///< Only accessed by the reader.
+
+    public:
+        TripleBuffer() :
+            buffers(),
+            backIndex(0),
+            middleIndex(1),
+            frontIndex(2)
+        {
+
+        }
+
+        /**
+         * @brief Get the buffer to write into. Must only be called by the writer.
+         */
+        T& getBackBuffer()
+        {
+            return buffers[backIndex];
+        }
+
+        /**
+         * @brief Publish the back buffer, the writer then gets another buffer to write into.
+         */
+        void publish()
+        {
+            backIndex = middleIndex.fetchAndStoreAcqRel(backIndex | FRESH_FLAG) & INDEX_MASK;
+        }
+
+        /**
+         * @brief Pick the latest published buffer up, if any. Must only be called by the reader.
+         *
+         * @return False if nothing has been published since the last update, the front buffer is then unchanged.
+         */
+        bool update()
+        {
+            if (!(middleIndex.loadAcquire() & FRESH_FLAG)) {
+                return false;
+            }
+
+            frontIndex = middleIndex.fetchAndStoreAcqRel(frontIndex) & INDEX_MASK;
+
+            return true;
+        }
+
+        /**
+         * @brief Get the latest buffer picked up by the reader.
+         */
+        const T& getFrontBuffer() const
+        {
+            return buffers[frontIndex];
+        }
+};
+
+#endif // TRIPLEBUFFER_HPP
@@ -59,6 +59,13 @@ BuildingInformation::~BuildingInformation()
 
 
 
+const QString& BuildingInformation::getKey() const
+{
+    return key;
+}
+
+
+
 BuildingInformation::Type BuildingInformation::getType() const
 {
     return type;
@@ -94,6 +101,13 @@ int BuildingInformation::getMaxWorkers() const
 
 
 
+int BuildingInformation::getWorkerPriority() const
+{
+    return common.workerPriority;
+}
+
+
+
 QList<Direction> BuildingInformation::getAvailableOrientations() const
 {
     return common.areaDescription.getAvailableOrientations();
@@ -259,7 +273,8 @@ BuildingInformation::Type BuildingInformation::resolveType(const QString& type)
 BuildingInformation::Common::Common(const QString& configDirectoryPath, const ModelReader& model) :
     title(model.getString("title")),
     areaDescription(configDirectoryPath, model),
-    maxWorkers(model.getOptionalInt("workers", 0))
+    maxWorkers(model.getOptionalInt("workers", 0)),
+    workerPriority(model.getOptionalInt("workerPriority", 0))
 {
 
 }
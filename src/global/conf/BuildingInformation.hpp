@@ -41,6 +41,7 @@ class BuildingInformation
             QString title;
             BuildingAreaInformation areaDescription;
             int maxWorkers;
+            int workerPriority;///< Working places with a higher priority get their workers first.
 
             explicit Common(const QString& configDirectoryPath, const ModelReader& model);
         };
@@ -144,11 +145,13 @@ class BuildingInformation
         ~BuildingInformation();
 
         // Generic information.
+        const QString& getKey() const;
         Type getType() const;
         const QString& getTitle() const;
         const BuildingAreaInformation& getAreaDescription() const;
         TileAreaSize getSize(Direction orientation) const;
         int getMaxWorkers() const;
+        int getWorkerPriority() const;
 
         // Graphics information.
         QList<Direction> getAvailableOrientations() const;
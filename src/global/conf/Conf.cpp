@@ -1,5 +1,6 @@
 #include "Conf.hpp"
 
+#include <QtCore/QVector>
 #include <yaml-cpp/yaml.h>
 
 #include "src/exceptions/BadConfigurationException.hpp"
@@ -44,7 +45,10 @@ Conf::Conf(const QString& directoryPath) :
     for (auto node : configurationRoot["items"]) {
         QString key(node.first.as<QString>());
         ItemInformation::checkModel(key, node.second);
-        items.insert(key, new ItemInformation(key, node.second));
+        if (items.size() >= MAX_ITEM_TYPES) {
+            throw BadConfigurationException("Too many items in configuration, the maximum is " + QString::number(MAX_ITEM_TYPES) + ".");
+        }
+        items.insert(key, new ItemInformation(items.size(), key, node.second));
     }
 
     // Load characters' configuration.
@@ -92,6 +96,18 @@ const QSize& Conf::getTileSize() const
 
 
 
+QList<QString> Conf::getAllItemKeys() const
+{
+    QVector<QString> keys(items.size());
+    for (auto item : items) {
+        keys[item->getIndex()] = item->getKey();
+    }
+
+    return keys.toList();
+}
+
+
+
 const ItemInformation& Conf::getItemConf(const QString& key) const
 {
     if (!items.contains(key)) {
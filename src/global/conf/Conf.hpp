@@ -32,6 +32,11 @@ class Conf
 
         const QSize& getTileSize() const;
 
+        /**
+         * @brief Get the keys of the items, in the order of their indexes.
+         */
+        QList<QString> getAllItemKeys() const;
+
         const ItemInformation& getItemConf(const QString& key) const;
 
         QList<QString> getAllBuildingKeys() const;
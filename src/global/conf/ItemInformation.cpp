@@ -7,7 +7,8 @@
 
 
 
-ItemInformation::ItemInformation(const QString& key, const YAML::Node& model) :
+ItemInformation::ItemInformation(const int index, const QString& key, const YAML::Node& model) :
+    index(index),
     key(key),
     title(model["title"] ? model["title"].as<QString>() : "")
 {
@@ -23,6 +24,13 @@ bool ItemInformation::operator!=(const ItemInformation& other) const
 
 
 
+int ItemInformation::getIndex() const
+{
+    return index;
+}
+
+
+
 const QString& ItemInformation::getKey() const
 {
     return key;
@@ -12,13 +12,18 @@ class ItemInformation
         Q_DISABLE_COPY_MOVE(ItemInformation)
 
     private:
+        int index;
         QString key;
         QString title;
 
     public:
-        ItemInformation(const QString& key, const YAML::Node& model);
+        ItemInformation(const int index, const QString& key, const YAML::Node& model);
         bool operator!=(const ItemInformation& other) const;
 
+        /**
+         * @brief Get the index of the item type, between 0 and MAX_ITEM_TYPES (excluded), in configuration order.
+         */
+        int getIndex() const;
         const QString& getKey() const;
         const QString& getTitle() const;
 
@@ -23,6 +23,13 @@ NatureElementInformation::NatureElementInformation(
 
 
 
+const QString& NatureElementInformation::getKey() const
+{
+    return key;
+}
+
+
+
 const QString& NatureElementInformation::getTitle() const
 {
     return title;
@@ -28,6 +28,7 @@ class NatureElementInformation
     public:
         NatureElementInformation(const QString& configDirectoryPath, const QString& key, const YAML::Node& model);
 
+        const QString& getKey() const;
         const QString& getTitle() const;
 
         bool isTraversable() const;
@@ -1,5 +1,6 @@
 #include "TileCoordinates.hpp"
 
+#include <QtCore/QHash>
 #include <QtCore/QPoint>
 #include <QtCore/QtMath>
 
@@ -10,7 +11,7 @@
 TileCoordinates::TileCoordinates(int x, int y) :
     _x(x),
     _y(y),
-    _hash(resolveHash(_x, _y))
+    _valid(true)
 {
 
 }
@@ -53,9 +54,9 @@ int TileCoordinates::y() const
 
 
 
-const QString& TileCoordinates::hash() const
+QString TileCoordinates::hash() const
 {
-    return _hash;
+    return QString::number(_x) + ';' + QString::number(_y);
 }
 
 
@@ -94,7 +95,7 @@ qreal TileCoordinates::straightDistanceTo(const TileCoordinates& other) const
 TileCoordinates::TileCoordinates() :
     _x(-1),
     _y(-1),
-    _hash()
+    _valid(false)
 {
 
 }
@@ -103,12 +104,16 @@ TileCoordinates::TileCoordinates() :
 
 bool TileCoordinates::isValid() const
 {
-    return !_hash.isEmpty();
+    return _valid;
 }
 
 
 
-QString TileCoordinates::resolveHash(int x, int y)
+uint qHash(const TileCoordinates& coordinates, uint seed)
 {
-    return QString::number(x) + ';' + QString::number(y);
+    // Both coordinates packed in a single integer, with no allocation.
+    return qHash(
+        (static_cast<quint64>(static_cast<quint32>(coordinates.x())) << 32) | static_cast<quint32>(coordinates.y()),
+        seed
+    );
 }
@@ -8,6 +8,9 @@ class QPoint;
 
 /**
  * @brief The coordinates of a tile on the map.
+ *
+ * Coordinates are a plain pair of integers, copied without any allocation. They are used as QHash keys as they are
+ * (see qHash()), their string hash is only meant for display.
  */
 class TileCoordinates
 {
@@ -19,7 +22,7 @@ class TileCoordinates
 
         int x() const;
         int y() const;
-        const QString& hash() const;
+        QString hash() const;
 
         DynamicElementCoordinates toDynamicElementCoordinates() const;
 
@@ -32,12 +35,12 @@ class TileCoordinates
         TileCoordinates();
         bool isValid() const;
 
-        static QString resolveHash(int x, int y);
-
     private:
         int _x;
         int _y;
-        QString _hash;
+        bool _valid;
 };
 
+uint qHash(const TileCoordinates& coordinates, uint seed = 0);
+
 #endif // TILECOORDINATES_HPP
@@ -0,0 +1,293 @@
+#ifndef HANDLE_HPP
+#define HANDLE_HPP
+
+#include <cassert>
+#include <QtCore/QHash>
+#include <QtCore/QVector>
+
+#include "src/defines.hpp"
+
+template<class T> class HandleTable;
+
+/**
+ * @brief A weak reference to an object owned by a registry, made of a slot index and a generation.
+ *
+ * A handle does not keep the referenced object alive and does not point to it directly: it must be resolved through the
+ * handle table of the owning registry. Each time a slot of the table is released, its generation changes, so a handle
+ * to a destroyed object never resolves, even if its slot has been reused by a new object since.
+ *
+ * Contrary to QWeakPointer, copying or resolving a handle does not involve any reference counting.
+ */
+template<class T>
+class Handle
+{
+        friend class HandleTable<T>;
+
+    private:
+        quint32 index;
+        quint32 generation;///< Zero for a null handle, the generations of the table slots start at one.
+
+    private:
+        Handle(const quint32 index, const quint32 generation) :
+            index(index),
+            generation(generation)
+        {
+
+        }
+
+    public:
+        Handle() :
+            index(0),
+            generation(0)
+        {
+
+        }
+
+        bool isNull() const
+        {
+            return generation == 0;
+        }
+
+        void clear()
+        {
+            index = 0;
+            generation = 0;
+        }
+
+        bool operator==(const Handle& other) const
+        {
+            return index == other.index && generation == other.generation;
+        }
+
+        bool operator!=(const Handle& other) const
+        {
+            return !(*this == other);
+        }
+
+        /**
+         * @brief Pack the handle into a single integer, to be saved.
+         */
+        quint64 pack() const
+        {
+            return (quint64(generation) << 32) | index;
+        }
+
+        static Handle unpack(const quint64 packedHandle)
+        {
+            return { quint32(packedHandle), quint32(packedHandle >> 32) };
+        }
+
+        friend uint qHash(const Handle& handle, uint seed = 0)
+        {
+            return qHash(handle.pack(), seed);
+        }
+};
+
+
+
+/**
+ * @brief A dense table of objects, referenced through handles.
+ *
+ * The objects are kept contiguously, in the order of insertion, so that iterating them is a linear walk through an
+ * array. A removed object is replaced by the last one (swap-remove): removal is done in constant time and the iteration
+ * order only depends on the sequence of insertions and removals, never on memory addresses.
+ *
+ * Handles do not point to the objects directly but to a slot holding the current position of the object in the dense
+ * array. Resolving a handle is a bounds check, a generation comparison and an indexed read, so stale handles are detected
+ * in constant time. Each time a slot is released, its generation changes.
+ *
+ * The table does not own the objects: the registry inserts an object when it takes ownership of it and removes it
+ * right before destroying it. The table is not thread-safe.
+ */
+template<class T>
+class HandleTable
+{
+        Q_DISABLE_COPY_MOVE(HandleTable)
+
+    private:
+        struct Slot {
+            int objectIndex;///< The position of the object in the dense array, -1 for released slots.
+            quint32 generation;
+        };
+
+        QVector<T*> objects;
+        QVector<quint32> objectSlots;///< The slot of each object of the dense array.
+        QVector<Slot> handleSlots;
+        QVector<quint32> releasedSlots;
+
+    public:
+        using const_iterator = typename QVector<T*>::const_iterator;
+
+    public:
+        HandleTable() :
+            objects(),
+            objectSlots(),
+            handleSlots(),
+            releasedSlots()
+        {
+
+        }
+
+        /**
+         * @brief Append a new object.
+         *
+         * @return The handle of the object.
+         */
+        Handle<T> insert(T* object)
+        {
+            assert(object);
+            quint32 slotIndex;
+            if (!releasedSlots.isEmpty()) {
+                slotIndex = releasedSlots.takeLast();
+            }
+            else {
+                slotIndex = handleSlots.size();
+                handleSlots.append({ -1, 1 });
+            }
+
+            handleSlots[slotIndex].objectIndex = objects.size();
+            objects.append(object);
+            objectSlots.append(slotIndex);
+
+            return { slotIndex, handleSlots.at(slotIndex).generation };
+        }
+
+        /**
+         * @brief Remove the object of the given handle, the last object takes its place.
+         *
+         * All the handles to this object become stale. Removing a stale handle does nothing.
+         */
+        void remove(const Handle<T>& handle)
+        {
+            if (!resolve(handle)) {
+                return;
+            }
+
+            auto& slot(handleSlots[handle.index]);
+            auto lastIndex(objects.size() - 1);
+            if (slot.objectIndex != lastIndex) {
+                objects[slot.objectIndex] = objects.at(lastIndex);
+                objectSlots[slot.objectIndex] = objectSlots.at(lastIndex);
+                handleSlots[objectSlots.at(slot.objectIndex)].objectIndex = slot.objectIndex;
+            }
+            objects.removeLast();
+            objectSlots.removeLast();
+
+            slot.objectIndex = -1;
+            ++slot.generation;
+            if (slot.generation == 0) {
+                // Zero is reserved for null handles.
+                slot.generation = 1;
+            }
+            releasedSlots.append(handle.index);
+        }
+
+        /**
+         * @brief Get the object of the given handle, or nullptr if the handle is null or stale.
+         */
+        optional<T*> resolve(const Handle<T>& handle) const
+        {
+            if (handle.index >= static_cast<quint32>(handleSlots.size())) {
+                return nullptr;
+            }
+
+            auto& slot(handleSlots.at(handle.index));
+            if (slot.generation != handle.generation || slot.objectIndex < 0) {
+                return nullptr;
+            }
+
+            return objects.at(slot.objectIndex);
+        }
+
+        /**
+         * @brief Get the generation of each slot, to be saved along with the released slots.
+         */
+        QVector<quint32> getSlotGenerations() const
+        {
+            QVector<quint32> generations(handleSlots.size());
+            for (int i(0); i < handleSlots.size(); ++i) {
+                generations[i] = handleSlots.at(i).generation;
+            }
+
+            return generations;
+        }
+
+        const QVector<quint32>& getReleasedSlots() const
+        {
+            return releasedSlots;
+        }
+
+        /**
+         * @brief Restore the slots of an empty table, so that the saved handles can be restored.
+         *
+         * All the slots are released until their object is restored with restore().
+         */
+        void restoreSlots(const QVector<quint32>& generations, const QVector<quint32>& releasedSlots)
+        {
+            assert(objects.isEmpty());
+            handleSlots.resize(generations.size());
+            for (int i(0); i < generations.size(); ++i) {
+                handleSlots[i] = { -1, generations.at(i) };
+            }
+            this->releasedSlots = releasedSlots;
+        }
+
+        /**
+         * @brief Append an object with the handle it had when the table was saved.
+         *
+         * @return False if the handle does not match a free slot of the restored table.
+         */
+        bool restore(T* object, const Handle<T>& handle)
+        {
+            assert(object);
+            if (handle.isNull() || handle.index >= static_cast<quint32>(handleSlots.size())) {
+                return false;
+            }
+
+            auto& slot(handleSlots[handle.index]);
+            if (slot.generation != handle.generation || slot.objectIndex >= 0) {
+                return false;
+            }
+
+            slot.objectIndex = objects.size();
+            objects.append(object);
+            objectSlots.append(handle.index);
+
+            return true;
+        }
+
+        bool isAlive(const Handle<T>& handle) const
+        {
+            return resolve(handle) != nullptr;
+        }
+
+        bool isEmpty() const
+        {
+            return objects.isEmpty();
+        }
+
+        int size() const
+        {
+            return objects.size();
+        }
+
+        /**
+         * @brief Get the object at the given position of the dense array.
+         */
+        T* at(const int index) const
+        {
+            return objects.at(index);
+        }
+
+        const_iterator begin() const
+        {
+            return objects.constBegin();
+        }
+
+        const_iterator end() const
+        {
+            return objects.constEnd();
+        }
+};
+
+#endif // HANDLE_HPP
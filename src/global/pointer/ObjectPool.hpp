@@ -0,0 +1,115 @@
+#ifndef OBJECTPOOL_HPP
+#define OBJECTPOOL_HPP
+
+#include <cassert>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <QtCore/QList>
+
+#include "src/defines.hpp"
+
+/**
+ * @brief A pool allocating objects of a single type in slabs of slots.
+ *
+ * Objects are constructed in place into free slots. When an object is destroyed, its slot goes back to a free list and
+ * is reused by the next creation, so a steady churn of objects does not hit the general purpose allocator once the pool
+ * has grown to its working size. Slabs are only released with the pool: the pool must outlive all its objects.
+ *
+ * The pool is not thread-safe.
+ */
+template<class T, int SLOTS_PER_SLAB = 64>
+class ObjectPool
+{
+        Q_DISABLE_COPY_MOVE(ObjectPool)
+
+    private:
+        union Slot {
+            typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+            Slot* nextFreeSlot;
+        };
+
+        QList<owner<Slot*>> slabs;
+        Slot* firstFreeSlot;
+        int livingObjects;
+
+    public:
+        ObjectPool() :
+            slabs(),
+            firstFreeSlot(nullptr),
+            livingObjects(0)
+        {
+
+        }
+
+        ~ObjectPool()
+        {
+            assert(livingObjects == 0);
+            for (auto slab : slabs) {
+                delete[] slab;
+            }
+        }
+
+        /**
+         * @brief Construct a new object in a free slot.
+         */
+        template<class... Arguments>
+        T* create(Arguments&&... arguments)
+        {
+            if (!firstFreeSlot) {
+                allocateSlab();
+            }
+
+            // The link to the next free slot shares its memory with the object, so it is read before construction.
+            auto slot(firstFreeSlot);
+            firstFreeSlot = slot->nextFreeSlot;
+            T* object;
+            try {
+                object = new (&slot->storage) T(std::forward<Arguments>(arguments)...);
+            }
+            catch (...) {
+                slot->nextFreeSlot = firstFreeSlot;
+                firstFreeSlot = slot;
+                throw;
+            }
+            ++livingObjects;
+
+            return object;
+        }
+
+        /**
+         * @brief Destroy an object created by this pool and recycle its slot.
+         */
+        void destroy(T* object)
+        {
+            object->~T();
+            auto slot(reinterpret_cast<Slot*>(object));
+            slot->nextFreeSlot = firstFreeSlot;
+            firstFreeSlot = slot;
+            --livingObjects;
+        }
+
+        int getLivingObjectsCount() const
+        {
+            return livingObjects;
+        }
+
+        int getCapacity() const
+        {
+            return slabs.size() * SLOTS_PER_SLAB;
+        }
+
+    private:
+        void allocateSlab()
+        {
+            auto slab(new Slot[SLOTS_PER_SLAB]);
+            for (int i(0); i < SLOTS_PER_SLAB - 1; ++i) {
+                slab[i].nextFreeSlot = &slab[i + 1];
+            }
+            slab[SLOTS_PER_SLAB - 1].nextFreeSlot = firstFreeSlot;
+            firstFreeSlot = slab;
+            slabs.append(slab);
+        }
+};
+
+#endif // OBJECTPOOL_HPP
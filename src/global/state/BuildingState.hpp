@@ -1,7 +1,8 @@
 #ifndef BUILDINGSTATE_HPP
 #define BUILDINGSTATE_HPP
 
-#include <QtCore/QHash>
+#include <algorithm>
+#include <type_traits>
 
 #include "src/global/geometry/TileArea.hpp"
 #include "src/global/BuildingStatus.hpp"
@@ -9,50 +10,47 @@
 #include "src/defines.hpp"
 
 class BuildingInformation;
-class ItemInformation;
 
 struct FarmState
 {
-    FarmState(int growthPercent) :
-        growthPercent(growthPercent)
-    {}
-
     int growthPercent;
 };
 
 struct HouseState
 {
-    HouseState(int inhabitants) :
-        inhabitants(inhabitants)
-    {}
-
     int inhabitants;
 };
 
 struct ProducerState
 {
-    ProducerState(int rawMaterialStock, int productionPercent) :
-        rawMaterialStock(rawMaterialStock),
-        productionPercent(productionPercent)
-    {}
-
     int rawMaterialStock;
     int productionPercent;
 };
 
 struct StorageState
 {
-    StorageState(const QHash<const ItemInformation*, int>& stock) :
-        stock(stock)
-    {}
-
-    QHash<const ItemInformation*, int> stock;
+    int stock[MAX_ITEM_TYPES]; ///< The stored quantity of each item type, indexed by ItemInformation::getIndex().
 };
 
+/**
+ * @brief The state of a building.
+ *
+ * The state specific to the building type is stored inline, in a tagged union: a state never allocates and copying it
+ * is a plain copy of its members.
+ */
 struct BuildingState
 {
+    enum class Kind {
+        Common,
+        Farm,
+        House,
+        Industrial,
+        Producer,
+        Storage,
+    };
+
     BuildingState(
-        qintptr id,
+        quint64 id,
         const BuildingInformation& type,
         const TileArea& area,
         Direction orientation,
@@ -61,62 +59,26 @@ struct BuildingState
         int stateVersion
     ) :
         id(id),
-        type(type),
+        type(&type),
         area(area),
         orientation(orientation),
         status(status),
         workers(workers),
-        farm(nullptr),
-        house(nullptr),
-        industrial(nullptr),
-        producer(nullptr),
-        storage(nullptr),
-        stateVersion(stateVersion)
+        stateVersion(stateVersion),
+        kind(Kind::Common),
+        payload()
     {}
 
-    BuildingState(const BuildingState& other) :
-        id(other.id),
-        type(other.type),
-        area(other.area),
-        orientation(other.orientation),
-        status(other.status),
-        workers(other.workers),
-        farm(nullptr),
-        house(nullptr),
-        industrial(nullptr),
-        producer(nullptr),
-        storage(nullptr),
-        stateVersion(other.stateVersion)
-    {
-        if (other.farm) {
-            farm = new FarmState(*other.farm);
-        }
-        if (other.house) {
-            house = new HouseState(*other.house);
-        }
-        if (other.industrial) {
-            industrial = new ProducerState(*other.industrial);
-        }
-        if (other.producer) {
-            producer = new ProducerState(*other.producer);
-        }
-        if (other.storage) {
-            storage = new StorageState(*other.storage);
-        }
-    }
+    BuildingState(const BuildingState& other) = default;
+    BuildingState& operator=(const BuildingState& other) = default;
 
-    BuildingState& operator=(const BuildingState& other)
+    const BuildingInformation& getType() const
     {
-        if (this != &other) {
-            this->~BuildingState();
-            new(this) BuildingState(other);
-        }
-
-        return *this;
+        return *type;
     }
 
     static BuildingState CreateFarmState(
-        qintptr id,
+        quint64 id,
         const BuildingInformation& type,
         const TileArea& area,
         Direction orientation,
@@ -126,13 +88,14 @@ struct BuildingState
         int growthPercent
     ) {
         BuildingState state(id, type, area, orientation, status, workers, stateVersion);
-        state.farm = new FarmState(growthPercent);
+        state.kind = Kind::Farm;
+        state.payload.farm = { growthPercent };
 
         return state;
     }
 
     static BuildingState CreateHouseState(
-        qintptr id,
+        quint64 id,
         const BuildingInformation& type,
         const TileArea& area,
         Direction orientation,
@@ -142,13 +105,14 @@ struct BuildingState
         int inhabitants
     ) {
         BuildingState state(id, type, area, orientation, status, workers, stateVersion);
-        state.house = new HouseState(inhabitants);
+        state.kind = Kind::House;
+        state.payload.house = { inhabitants };
 
         return state;
     }
 
     static BuildingState CreateIndustrialState(
-        qintptr id,
+        quint64 id,
         const BuildingInformation& type,
         const TileArea& area,
         Direction orientation,
@@ -159,13 +123,14 @@ struct BuildingState
         int productionPercent
     ) {
         BuildingState state(id, type, area, orientation, status, workers, stateVersion);
-        state.industrial = new ProducerState(rawMaterialStock, productionPercent);
+        state.kind = Kind::Industrial;
+        state.payload.producer = { rawMaterialStock, productionPercent };
 
         return state;
     }
 
     static BuildingState CreateProducerState(
-        qintptr id,
+        quint64 id,
         const BuildingInformation& type,
         const TileArea& area,
         Direction orientation,
@@ -176,59 +141,76 @@ struct BuildingState
         int productionPercent
     ) {
         BuildingState state(id, type, area, orientation, status, workers, stateVersion);
-        state.producer = new ProducerState(rawMaterialStock, productionPercent);
+        state.kind = Kind::Producer;
+        state.payload.producer = { rawMaterialStock, productionPercent };
 
         return state;
     }
 
     static BuildingState CreateStorageState(
-        qintptr id,
+        quint64 id,
         const BuildingInformation& type,
         const TileArea& area,
         Direction orientation,
         BuildingStatus status,
         int workers,
         int stateVersion,
-        const QHash<const ItemInformation*, int>& stock
+        const int (&stock)[MAX_ITEM_TYPES]
     ) {
         BuildingState state(id, type, area, orientation, status, workers, stateVersion);
-        state.storage = new StorageState(stock);
+        state.kind = Kind::Storage;
+        std::copy(stock, stock + MAX_ITEM_TYPES, state.payload.storage.stock);
 
         return state;
     }
 
-    ~BuildingState()
+    optional<const FarmState*> getFarmState() const
     {
-        if (farm) {
-            delete farm;
-        }
-        if (house) {
-            delete house;
-        }
-        if (industrial) {
-            delete industrial;
-        }
-        if (producer) {
-            delete producer;
-        }
-        if (storage) {
-            delete storage;
-        }
+        return kind == Kind::Farm ? &payload.farm : nullptr;
     }
 
-    qintptr id;
-    const BuildingInformation& type;
+    optional<const HouseState*> getHouseState() const
+    {
+        return kind == Kind::House ? &payload.house : nullptr;
+    }
+
+    /**
+     * @brief Get the state specific to industrial buildings.
+     *
+     * Note, we use the producer state which contains the same needed attributes for industrial buildings.
+     */
+    optional<const ProducerState*> getIndustrialState() const
+    {
+        return kind == Kind::Industrial ? &payload.producer : nullptr;
+    }
+
+    optional<const ProducerState*> getProducerState() const
+    {
+        return kind == Kind::Producer ? &payload.producer : nullptr;
+    }
+
+    optional<const StorageState*> getStorageState() const
+    {
+        return kind == Kind::Storage ? &payload.storage : nullptr;
+    }
+
+    quint64 id;
+    const BuildingInformation* type; ///< Never null, a pointer keeps the state assignable. See getType().
     TileArea area;
     Direction orientation;
     BuildingStatus status;
     int workers;
-    optional<owner<FarmState*>> farm;
-    optional<owner<HouseState*>> house;
-    optional<owner<ProducerState*>> industrial; // Note, we use the producer state which contains the same needed attributes for industrial buildings.
-    optional<owner<ProducerState*>> producer;
-    optional<owner<StorageState*>> storage;
-
     int stateVersion; ///< We use an int for the versionning of the view. Note that an overflow is not dramatic since we always compare versions using equality.
+
+    Kind kind; ///< Indicate which member of the payload is set.
+    union Payload {
+        FarmState farm;
+        HouseState house;
+        ProducerState producer; ///< For both industrial and producer buildings.
+        StorageState storage;
+    } payload;
 };
 
+static_assert(std::is_trivially_copyable<BuildingState>::value, "A building state must be copied as plain memory.");
+
 #endif // BUILDINGSTATE_HPP
@@ -10,7 +10,7 @@ class CharacterInformation;
 struct CharacterState
 {
     CharacterState(
-        qintptr id,
+        quint64 id,
         const CharacterInformation& type,
         const DynamicElementCoordinates& position,
         Direction direction,
@@ -44,7 +44,7 @@ struct CharacterState
         return *this;
     }
 
-    qintptr id;
+    quint64 id;
     const CharacterInformation& type;
     DynamicElementCoordinates position;
     Direction direction;
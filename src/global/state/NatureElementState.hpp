@@ -7,7 +7,7 @@ class NatureElementInformation;
 
 struct NatureElementState
 {
-    NatureElementState(qintptr id, const NatureElementInformation& type, const TileArea& area) :
+    NatureElementState(quint64 id, const NatureElementInformation& type, const TileArea& area) :
         id(id),
         type(type),
         area(area)
@@ -29,7 +29,7 @@ struct NatureElementState
         return *this;
     }
 
-    qintptr id;
+    quint64 id;
     const NatureElementInformation& type;
     TileArea area;
 };
@@ -0,0 +1,47 @@
+#ifndef STATEDELTA_HPP
+#define STATEDELTA_HPP
+
+#include <QtCore/QList>
+
+#include "src/global/state/BuildingState.hpp"
+#include "src/global/state/CharacterState.hpp"
+#include "src/global/state/CityState.hpp"
+#include "src/global/state/NatureElementState.hpp"
+
+/**
+ * @brief The changes of the elements states since a previous version of the state.
+ *
+ * Applying a delta is idempotent: an element may be listed as created while already known by the consumer (it should
+ * then be updated) and a destroyed element may be unknown by the consumer (it should then be ignored). A full resync
+ * lists all the current elements as created: the consumer must drop any element that is not listed.
+ */
+struct StateDelta
+{
+    StateDelta(int version, bool isFullResync, const CityState& cityState) :
+        version(version),
+        isFullResync(isFullResync),
+        city(cityState),
+        createdNatureElements(),
+        destroyedNatureElements(),
+        createdBuildings(),
+        changedBuildings(),
+        destroyedBuildings(),
+        createdCharacters(),
+        changedCharacters(),
+        destroyedCharacters()
+    {}
+
+    int version; ///< The version of the state, to acknowledge once the delta has been applied.
+    bool isFullResync;
+    CityState city;
+    QList<NatureElementState> createdNatureElements;
+    QList<quint64> destroyedNatureElements;
+    QList<BuildingState> createdBuildings;
+    QList<BuildingState> changedBuildings;
+    QList<quint64> destroyedBuildings;
+    QList<CharacterState> createdCharacters;
+    QList<CharacterState> changedCharacters;
+    QList<quint64> destroyedCharacters;
+};
+
+#endif // STATEDELTA_HPP
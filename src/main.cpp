@@ -1,11 +1,61 @@
+#include <cstring>
 #include <QApplication>
+#include <QtCore/QCommandLineParser>
+#include <QtCore/QTextStream>
 
+#include "src/engine/simulation/SimulationHost.hpp"
+#include "src/global/conf/Conf.hpp"
 #include "src/ui/MainWindow.hpp"
 
 
 
+/**
+ * @brief Run a batch of cities without any viewer and print the throughput of each one.
+ *
+ * Usage: CityBuilderEngine --headless [--cycles <quantity>] [--threads <quantity>] <city files...>
+ */
+int runHeadless(int argc, char* argv[])
+{
+    QCoreApplication application(argc, argv);
+
+    QCommandLineParser parser;
+    parser.addHelpOption();
+    parser.addOption({ "headless", "Run the cities without any viewer." });
+    parser.addOption({ "cycles", "The quantity of cycles to process on each city.", "quantity", "3000" });
+    parser.addOption({ "threads", "The maximum quantity of threads to use.", "quantity", "0" });
+    parser.addPositionalArgument("cities", "The city files or saved cities to simulate.", "<city files...>");
+    parser.process(application);
+
+    Conf conf("assets/zeus");
+    SimulationHost host(conf, parser.value("threads").toInt());
+    for (auto cityFilePath : parser.positionalArguments()) {
+        host.addCity(cityFilePath);
+    }
+
+    QTextStream output(stdout);
+    int failures(0);
+    for (const auto& report : host.run(parser.value("cycles").toInt())) {
+        output << report.cityFilePath << ": ";
+        if (!report.error.isEmpty()) {
+            output << "FAILED (" << report.error << ")\n";
+            ++failures;
+            continue;
+        }
+        output << report.title << ", " << report.processedCycles << " cycles in " << report.processingTime << "ms ("
+            << report.getCyclesPerSecond() << " cycles/s, loaded in " << report.loadingTime << "ms)\n";
+    }
+
+    return failures > 0 ? 1 : 0;
+}
+
+
+
 int main(int argc, char* argv[])
 {
+    if (argc > 1 && std::strcmp(argv[1], "--headless") == 0) {
+        return runHeadless(argc, argv);
+    }
+
     QApplication application(argc, argv);
 
     auto window(new MainWindow("assets/zeus"));
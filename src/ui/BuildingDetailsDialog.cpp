@@ -12,25 +12,28 @@
 BuildingDetailsDialog::BuildingDetailsDialog(const BuildingState& state) :
     QDialog()
 {
-    auto title(new QLabel(state.type.getTitle(), this));
+    auto title(new QLabel(state.getType().getTitle(), this));
 
     auto workers(new QLabel(this));
-    if (state.type.getMaxWorkers() > 0) {
-        workers->setText("Workers: " + QString::number(state.workers) + "/" + QString::number(state.type.getMaxWorkers()));
+    if (state.getType().getMaxWorkers() > 0) {
+        workers->setText("Workers: " + QString::number(state.workers) + "/" + QString::number(state.getType().getMaxWorkers()));
     }
 
     auto stockDetails(new QLabel(this));
     auto productionDetails(new QLabel(this));
-    if (state.farm) {
-        productionDetails->setText("Growth: " + QString::number(state.farm->growthPercent) + "%");
+    auto farm(state.getFarmState());
+    auto industrial(state.getIndustrialState());
+    auto producer(state.getProducerState());
+    if (farm) {
+        productionDetails->setText("Growth: " + QString::number(farm->growthPercent) + "%");
     }
-    else if (state.industrial) {
-        stockDetails->setText("Stock: " + QString::number(state.industrial->rawMaterialStock) + " " + state.type.getIndustrialConf().rawMaterialConf.getTitle());
-        productionDetails->setText("Production: " + QString::number(state.industrial->productionPercent) + "%");
+    else if (industrial) {
+        stockDetails->setText("Stock: " + QString::number(industrial->rawMaterialStock) + " " + state.getType().getIndustrialConf().rawMaterialConf.getTitle());
+        productionDetails->setText("Production: " + QString::number(industrial->productionPercent) + "%");
     }
-    else if (state.producer) {
-        stockDetails->setText("Stock: " + QString::number(state.producer->rawMaterialStock) + " " + state.type.getProducerConf().producedItemConf.getTitle());
-        productionDetails->setText("Production: " + QString::number(state.producer->productionPercent) + "%");
+    else if (producer) {
+        stockDetails->setText("Stock: " + QString::number(producer->rawMaterialStock) + " " + state.getType().getProducerConf().producedItemConf.getTitle());
+        productionDetails->setText("Production: " + QString::number(producer->productionPercent) + "%");
     }
 
     // Layout
@@ -1,16 +1,21 @@
 #include "MainWindow.hpp"
 
+#include <QtWidgets/QDockWidget>
+#include <QtWidgets/QFileDialog>
 #include <QtWidgets/QInputDialog>
 #include <QtWidgets/QGraphicsView>
 #include <QtWidgets/QMenu>
 #include <QtWidgets/QMenuBar>
+#include <QtWidgets/QMessageBox>
 #include <QtWidgets/QShortcut>
 
+#include "src/exceptions/Exception.hpp"
 #include "src/global/conf/BuildingInformation.hpp"
 #include "src/global/conf/Conf.hpp"
 #include "src/global/state/MapState.hpp"
 #include "src/ui/controlPanel/ControlPanel.hpp"
 #include "src/ui/InformationWidget.hpp"
+#include "src/ui/MiniMap.hpp"
 #include "src/viewer/MapScene.hpp"
 
 
@@ -22,7 +27,10 @@ MainWindow::MainWindow(const QString& gameConfigDirectoryPath) :
     viewerScene(nullptr),
     viewer(nullptr),
     controlPanel(new ControlPanel(conf)),
+    miniMapPanel(new QDockWidget(tr("Map"), this)),
+    miniMap(nullptr),
     pauseAction(new QAction(tr("Pause"), this)),
+    saveAction(new QAction(tr("Save the game"), this)),
     speedAction(new QAction(tr("Speed"), this)),
 #ifdef DEBUG_TOOLS
     processAction(new QAction("Process next step", this)),
@@ -38,6 +46,16 @@ MainWindow::MainWindow(const QString& gameConfigDirectoryPath) :
     pauseAction->setCheckable(true);
     gameMenu->addAction(pauseAction);
 
+    QAction* openAction(new QAction(tr("Open a saved game"), this));
+    openAction->setShortcut(QKeySequence::Open);
+    gameMenu->addAction(openAction);
+    connect(openAction, &QAction::triggered, this, &MainWindow::openSavedGame);
+
+    saveAction->setShortcut(QKeySequence::Save);
+    saveAction->setDisabled(true);
+    gameMenu->addAction(saveAction);
+    connect(saveAction, &QAction::triggered, this, &MainWindow::saveGame);
+
     QAction* quitAction(new QAction(tr("Close the game"), this));
     quitAction->setShortcut(QKeySequence::Quit);
     gameMenu->addAction(quitAction);
@@ -68,6 +86,11 @@ MainWindow::MainWindow(const QString& gameConfigDirectoryPath) :
     // Control panel.
     addDockWidget(Qt::RightDockWidgetArea, controlPanel);
 
+    // Mini map.
+    miniMapPanel->setAllowedAreas(Qt::RightDockWidgetArea);
+    miniMapPanel->setFeatures(QDockWidget::NoDockWidgetFeatures);
+    addDockWidget(Qt::RightDockWidgetArea, miniMapPanel);
+
     // Communication with the engine.
     connect(pauseAction, &QAction::triggered, &engine, &Engine::pause);
     connect(this, &MainWindow::requestSpeedRatioChange, &engine, &Engine::setProcessorSpeedRatio);
@@ -81,30 +104,75 @@ MainWindow::MainWindow(const QString& gameConfigDirectoryPath) :
 
 void MainWindow::loadMap(const QString& filePath)
 {
+    // The current city is kept if the file cannot be loaded.
+    engine.loadCity(filePath);
+
     if (viewer) {
         delete viewer;
     }
     if (viewerScene) {
         delete viewerScene;
     }
-    engine.loadCity(filePath);
-    const auto initialState(engine.getCurrentState());
+    if (miniMap) {
+        delete miniMap;
+    }
+    auto& initialState(engine.getInitialState());
     informationWidget->updateState(initialState.city);
 
     viewerScene = new MapScene(conf, engine, engine, *this, engine.getMapState(), initialState);
     viewer = new QGraphicsView(viewerScene);
     setCentralWidget(viewer);
+    miniMap = new MiniMap(engine.getMapState(), initialState);
+    miniMapPanel->setWidget(miniMap);
     connect(controlPanel, &ControlPanel::buildingRequested, viewerScene, &MapScene::requestBuildingPositioning);
     connect(rotateAction, &QShortcut::activated, viewerScene, &MapScene::requestBuildingRotation);
     connect(viewerScene, &MapScene::buildingCreationRequested, &engine, &Engine::createBuilding);
+    connect(&engine, &Engine::constructibilityChecked, viewerScene, &MapScene::updateConstructibility);
+    connect(&engine, &Engine::shortestPathForRoadGenerated, viewerScene, &MapScene::updateRoadPath);
+    connect(miniMap, &MiniMap::locationSelected, viewerScene, &MapScene::centerOn);
 
     speedAction->setEnabled(true);
+    saveAction->setEnabled(true);
     pauseAction->setChecked(false);
     engine.pause(false);
 }
 
 
 
+void MainWindow::openSavedGame()
+{
+    auto filePath(QFileDialog::getOpenFileName(this, tr("Open a saved game"), QString(), tr("Saved cities (*.city)")));
+    if (filePath.isEmpty()) {
+        return;
+    }
+
+    try {
+        loadMap(filePath);
+    }
+    catch (const Exception& exception) {
+        QMessageBox::warning(this, tr("Open a saved game"), exception.getMessage());
+    }
+}
+
+
+
+void MainWindow::saveGame()
+{
+    auto filePath(QFileDialog::getSaveFileName(this, tr("Save the game"), QString(), tr("Saved cities (*.city)")));
+    if (filePath.isEmpty()) {
+        return;
+    }
+
+    try {
+        engine.saveCity(filePath);
+    }
+    catch (const Exception& exception) {
+        QMessageBox::warning(this, tr("Save the game"), exception.getMessage());
+    }
+}
+
+
+
 void MainWindow::openSpeedDialog()
 {
     bool isPaused(pauseAction->isChecked());
@@ -142,8 +210,10 @@ void MainWindow::displayDialog(QDialog& dialog)
 
 
 
-void MainWindow::updateState(State state)
+void MainWindow::updateState(StateDelta delta)
 {
-    informationWidget->updateState(state.city);
-    viewerScene->refresh(state);
+    informationWidget->updateState(delta.city);
+    viewerScene->refresh(delta);
+    miniMap->refresh(delta);
+    engine.acknowledgeState(delta.version);
 }
@@ -11,7 +11,9 @@
 class ControlPanel;
 class InformationWidget;
 class MapScene;
+class MiniMap;
 class QAction;
+class QDockWidget;
 class QGraphicsView;
 class QShortcut;
 
@@ -25,7 +27,10 @@ class MainWindow : public QMainWindow, public DialogDisplayer
         MapScene* viewerScene;
         QGraphicsView* viewer;
         ControlPanel* controlPanel;
+        QDockWidget* miniMapPanel;
+        MiniMap* miniMap;
         QAction* pauseAction;
+        QAction* saveAction;
         QAction* speedAction;
 #ifdef DEBUG_TOOLS
         QAction* processAction;
@@ -39,11 +44,13 @@ class MainWindow : public QMainWindow, public DialogDisplayer
 
     public slots:
         void loadMap(const QString& filePath);
+        void openSavedGame();
+        void saveGame();
 
         void openSpeedDialog();
         virtual void displayDialog(QDialog& dialog) override;
 
-        void updateState(State state);
+        void updateState(StateDelta delta);
 
     signals:
         void requestSpeedRatioChange(const qreal speedRatio);
@@ -0,0 +1,338 @@
+#include "MiniMap.hpp"
+
+#include <QtGui/QMouseEvent>
+#include <QtGui/QPainter>
+
+#include "src/global/conf/BuildingInformation.hpp"
+#include "src/global/geometry/DynamicElementCoordinates.hpp"
+#include "src/global/state/MapState.hpp"
+#include "src/global/state/State.hpp"
+#include "src/global/state/StateDelta.hpp"
+
+const int MINIMAP_WIDTH(240);
+const QRgb BACKGROUND_COLOR(qRgb(0, 0, 0));
+const QRgb GROUND_COLOR(qRgb(92, 128, 56));
+const QRgb NATURE_ELEMENT_COLOR(qRgb(40, 80, 32));
+const QRgb CHARACTER_COLOR(qRgb(255, 255, 255));
+const int CHARACTER_DENSITY_SATURATION(4);///< The quantity of characters from which a tile gets the character color.
+
+
+
+static QRgb resolveBuildingColor(const BuildingInformation& buildingConf)
+{
+    switch (buildingConf.getType()) {
+        case BuildingInformation::Type::Farm:
+            return qRgb(216, 196, 72);
+
+        case BuildingInformation::Type::House:
+            return qRgb(200, 152, 96);
+
+        case BuildingInformation::Type::Industrial:
+            return qRgb(168, 64, 56);
+
+        case BuildingInformation::Type::Laboratory:
+        case BuildingInformation::Type::Sanity:
+        case BuildingInformation::Type::School:
+            return qRgb(72, 120, 200);
+
+        case BuildingInformation::Type::MapEntryPoint:
+            return qRgb(224, 224, 224);
+
+        case BuildingInformation::Type::Producer:
+            return qRgb(144, 96, 56);
+
+        case BuildingInformation::Type::Road:
+            return qRgb(128, 128, 128);
+
+        case BuildingInformation::Type::Storage:
+            return qRgb(120, 80, 160);
+    }
+
+    return GROUND_COLOR;
+}
+
+
+
+MiniMap::MiniMap(const MapState& mapState, const State& initialState, QWidget* parent) :
+    QWidget(parent),
+    groundRaster(mapState.size.width() + 2, mapState.size.height(), QImage::Format_RGB32),
+    raster(),
+    elementColors(groundRaster.width() * groundRaster.height(), GROUND_COLOR),
+    characterCounts(groundRaster.width() * groundRaster.height(), 0),
+    natureElementAreas(),
+    buildingAreas(),
+    characterPixels(),
+    dirtyArea(),
+    displayRect()
+{
+    // Draw the ground of the tiles of the map, the same way as the map scene creates them.
+    groundRaster.fill(BACKGROUND_COLOR);
+    auto pixels(reinterpret_cast<QRgb*>(groundRaster.bits()));
+    int line(0);
+    int column(0);
+    while (line < mapState.size.height()) {
+        int adjust(line > mapState.size.width() ? 1 : 2);
+        while (column < (mapState.size.width() - line + adjust) / 2) {
+            auto pixel(resolvePixel(column, line + column));
+            if (pixel >= 0) {
+                pixels[pixel] = GROUND_COLOR;
+                pixels[pixel + 1] = GROUND_COLOR;
+            }
+
+            ++column;
+        }
+        ++line;
+        column = -line / 2;
+    }
+    raster = groundRaster;
+
+    for (auto& natureElementState : initialState.natureElements) {
+        natureElementAreas.insert(natureElementState.id, natureElementState.area);
+        paintArea(natureElementState.area, NATURE_ELEMENT_COLOR);
+    }
+    for (auto& buildingState : initialState.buildings) {
+        buildingAreas.insert(buildingState.id, buildingState.area);
+        paintArea(buildingState.area, resolveBuildingColor(buildingState.getType()));
+    }
+    for (auto& characterState : initialState.characters) {
+        updateCharacter(characterState);
+    }
+    dirtyArea = QRect();
+}
+
+
+
+void MiniMap::refresh(const StateDelta& delta)
+{
+    if (delta.isFullResync) {
+        // All the current elements are listed as created.
+        reset();
+    }
+
+    for (auto natureElementId : delta.destroyedNatureElements) {
+        auto iterator(natureElementAreas.find(natureElementId));
+        if (iterator != natureElementAreas.end()) {
+            paintArea(iterator.value(), GROUND_COLOR);
+            natureElementAreas.erase(iterator);
+        }
+    }
+    for (auto& natureElementState : delta.createdNatureElements) {
+        if (!natureElementAreas.contains(natureElementState.id)) {
+            natureElementAreas.insert(natureElementState.id, natureElementState.area);
+            paintArea(natureElementState.area, NATURE_ELEMENT_COLOR);
+        }
+    }
+
+    // The area of a building never changes, only the created and destroyed buildings matter.
+    for (auto buildingId : delta.destroyedBuildings) {
+        auto iterator(buildingAreas.find(buildingId));
+        if (iterator != buildingAreas.end()) {
+            paintArea(iterator.value(), GROUND_COLOR);
+            buildingAreas.erase(iterator);
+        }
+    }
+    for (auto& buildingState : delta.createdBuildings) {
+        if (!buildingAreas.contains(buildingState.id)) {
+            buildingAreas.insert(buildingState.id, buildingState.area);
+            paintArea(buildingState.area, resolveBuildingColor(buildingState.getType()));
+        }
+    }
+
+    for (auto characterId : delta.destroyedCharacters) {
+        auto iterator(characterPixels.find(characterId));
+        if (iterator != characterPixels.end()) {
+            removeCharacter(iterator.value());
+            characterPixels.erase(iterator);
+        }
+    }
+    for (auto& characterState : delta.createdCharacters) {
+        updateCharacter(characterState);
+    }
+    for (auto& characterState : delta.changedCharacters) {
+        updateCharacter(characterState);
+    }
+
+    if (!dirtyArea.isNull() && !displayRect.isEmpty()) {
+        qreal xScale(displayRect.width() / qreal(raster.width()));
+        qreal yScale(displayRect.height() / qreal(raster.height()));
+        // With a margin for the smoothing of the scaled raster.
+        update(QRectF(
+            displayRect.x() + dirtyArea.x() * xScale - 1.0,
+            displayRect.y() + dirtyArea.y() * yScale - 1.0,
+            dirtyArea.width() * xScale + 2.0,
+            dirtyArea.height() * yScale + 2.0
+        ).toAlignedRect());
+    }
+    dirtyArea = QRect();
+}
+
+
+
+QSize MiniMap::sizeHint() const
+{
+    return { MINIMAP_WIDTH, MINIMAP_WIDTH * raster.height() / raster.width() };
+}
+
+
+
+void MiniMap::paintEvent(QPaintEvent* /*event*/)
+{
+    QPainter painter(this);
+    painter.setRenderHint(QPainter::SmoothPixmapTransform);
+    painter.drawImage(displayRect, raster);
+}
+
+
+
+void MiniMap::resizeEvent(QResizeEvent* /*event*/)
+{
+    auto displaySize(raster.size().scaled(size(), Qt::KeepAspectRatio));
+    displayRect = QRect(
+        QPoint((width() - displaySize.width()) / 2, (height() - displaySize.height()) / 2),
+        displaySize
+    );
+}
+
+
+
+void MiniMap::mousePressEvent(QMouseEvent* event)
+{
+    if (event->button() == Qt::LeftButton) {
+        selectLocation(event->pos());
+    }
+}
+
+
+
+void MiniMap::mouseMoveEvent(QMouseEvent* event)
+{
+    if (event->buttons() & Qt::LeftButton) {
+        selectLocation(event->pos());
+    }
+}
+
+
+
+void MiniMap::reset()
+{
+    raster = groundRaster;
+    elementColors.fill(GROUND_COLOR);
+    characterCounts.fill(0);
+    natureElementAreas.clear();
+    buildingAreas.clear();
+    characterPixels.clear();
+    dirtyArea = raster.rect();
+}
+
+
+
+int MiniMap::resolvePixel(const int x, const int y) const
+{
+    // The lines of the map are the rows of the raster.
+    int column(x + y);
+    int row(y - x);
+    if (column < 0 || column + 1 >= groundRaster.width() || row < 0 || row >= groundRaster.height()) {
+        return -1;
+    }
+
+    return row * groundRaster.width() + column;
+}
+
+
+
+int MiniMap::resolvePixel(const DynamicElementCoordinates& location) const
+{
+    // Same rounding as DynamicElementCoordinates::associatedTileCoordinates(), without hashing the coordinates.
+    return resolvePixel(qRound(location.x()), qRound(location.y()));
+}
+
+
+
+void MiniMap::paintArea(const TileArea& area, const QRgb color)
+{
+    for (auto coordinates : area) {
+        auto pixel(resolvePixel(coordinates.x(), coordinates.y()));
+        if (pixel >= 0) {
+            elementColors[pixel] = color;
+            paintTile(pixel);
+        }
+    }
+}
+
+
+
+void MiniMap::updateCharacter(const CharacterState& characterState)
+{
+    auto pixel(resolvePixel(characterState.position));
+    auto iterator(characterPixels.find(characterState.id));
+    if (iterator == characterPixels.end()) {
+        characterPixels.insert(characterState.id, pixel);
+        addCharacter(pixel);
+    }
+    else if (iterator.value() != pixel) {
+        removeCharacter(iterator.value());
+        iterator.value() = pixel;
+        addCharacter(pixel);
+    }
+}
+
+
+
+void MiniMap::addCharacter(const int pixel)
+{
+    if (pixel >= 0) {
+        ++characterCounts[pixel];
+        paintTile(pixel);
+    }
+}
+
+
+
+void MiniMap::removeCharacter(const int pixel)
+{
+    if (pixel >= 0) {
+        --characterCounts[pixel];
+        paintTile(pixel);
+    }
+}
+
+
+
+void MiniMap::paintTile(const int pixel)
+{
+    auto color(elementColors.at(pixel));
+    auto density(qMin<int>(characterCounts.at(pixel), CHARACTER_DENSITY_SATURATION));
+    if (density > 0) {
+        // A single character is already visible, the color saturates with the density.
+        auto weight(CHARACTER_DENSITY_SATURATION + density);
+        auto total(2 * CHARACTER_DENSITY_SATURATION);
+        color = qRgb(
+            qRed(color) + (qRed(CHARACTER_COLOR) - qRed(color)) * weight / total,
+            qGreen(color) + (qGreen(CHARACTER_COLOR) - qGreen(color)) * weight / total,
+            qBlue(color) + (qBlue(CHARACTER_COLOR) - qBlue(color)) * weight / total
+        );
+    }
+
+    auto pixels(reinterpret_cast<QRgb*>(raster.bits()));
+    pixels[pixel] = color;
+    pixels[pixel + 1] = color;
+    dirtyArea |= QRect(pixel % raster.width(), pixel / raster.width(), 2, 1);
+}
+
+
+
+void MiniMap::selectLocation(const QPoint& position)
+{
+    if (!displayRect.contains(position)) {
+        return;
+    }
+
+    int column((position.x() - displayRect.x()) * raster.width() / displayRect.width());
+    int row((position.y() - displayRect.y()) * raster.height() / displayRect.height());
+    // A tile starts on the columns having the same parity as its row.
+    if ((column + row) % 2 != 0) {
+        --column;
+    }
+
+    emit locationSelected({ (column - row) / 2, (column + row) / 2 });
+}
@@ -0,0 +1,78 @@
+#ifndef MINIMAP_HPP
+#define MINIMAP_HPP
+
+#include <QtCore/QHash>
+#include <QtCore/QRect>
+#include <QtCore/QVector>
+#include <QtGui/QImage>
+#include <QtWidgets/QWidget>
+
+#include "src/global/geometry/TileArea.hpp"
+#include "src/global/geometry/TileCoordinates.hpp"
+
+class DynamicElementCoordinates;
+struct CharacterState;
+struct MapState;
+struct State;
+struct StateDelta;
+
+/**
+ * @brief A small raster of the whole map, to see the city at a glance and move the view across it.
+ *
+ * Each tile takes two pixels of the raster, side by side, and each line of the map takes a row: the raster has the
+ * shape of the map on screen. A tile is colored by the element covering it (ground, nature element, road or type of
+ * building) and brightened by the characters walking on it.
+ *
+ * The raster is not drawn again from the full state: each delta only updates the pixels of the elements it lists, and
+ * only the area of those pixels is repainted.
+ */
+class MiniMap : public QWidget
+{
+        Q_OBJECT
+
+    private:
+        QImage groundRaster;///< The raster of the map without any element.
+        QImage raster;
+        QVector<QRgb> elementColors;///< The color of the element covering each tile, by pixel.
+        QVector<quint16> characterCounts;///< The quantity of characters on each tile, by pixel.
+        QHash<quint64, TileArea> natureElementAreas;
+        QHash<quint64, TileArea> buildingAreas;
+        QHash<quint64, int> characterPixels;///< The pixel of the tile of each character.
+        QRect dirtyArea;///< The area of the raster changed since the last repaint request.
+        QRect displayRect;///< The area of the widget displaying the raster.
+
+    public:
+        MiniMap(const MapState& mapState, const State& initialState, QWidget* parent = nullptr);
+
+        /**
+         * @brief Update the raster with the changes of the state.
+         */
+        void refresh(const StateDelta& delta);
+
+        virtual QSize sizeHint() const override;
+
+    protected:
+        virtual void paintEvent(QPaintEvent* event) override;
+        virtual void resizeEvent(QResizeEvent* event) override;
+        virtual void mousePressEvent(QMouseEvent* event) override;
+        virtual void mouseMoveEvent(QMouseEvent* event) override;
+
+    signals:
+        /**
+         * @brief Indicate the user selected a location of the map, to center the view on it.
+         */
+        void locationSelected(const TileCoordinates& location);
+
+    private:
+        void reset();
+        int resolvePixel(const int x, const int y) const;
+        int resolvePixel(const DynamicElementCoordinates& location) const;
+        void paintArea(const TileArea& area, const QRgb color);
+        void updateCharacter(const CharacterState& characterState);
+        void addCharacter(const int pixel);
+        void removeCharacter(const int pixel);
+        void paintTile(const int pixel);
+        void selectLocation(const QPoint& position);
+};
+
+#endif // MINIMAP_HPP
@@ -0,0 +1,140 @@
+#include "GroundChunk.hpp"
+
+#include <QtCore/QtMath>
+#include <QtGui/QPainter>
+
+#include "src/global/geometry/TileAreaSize.hpp"
+#include "src/viewer/image/Image.hpp"
+#include "src/viewer/Positioning.hpp"
+
+const int GroundChunk::SIZE(32);
+const int MAX_SCALE_LEVEL(5);
+
+
+
+GroundChunk::GroundChunk(const Positioning& positioning, const Image& groundImage, const TileCoordinates& origin) :
+    QGraphicsItem(),
+    positioning(positioning),
+    groundImage(groundImage),
+    origin(origin),
+    tiles(SIZE * SIZE, { false, false }),
+    bounds(),
+    pixmap(),
+    scaleLevel(0)
+{
+    // Under all the tiles.
+    setZValue(-1.0);
+}
+
+
+
+TileCoordinates GroundChunk::resolveOrigin(const TileCoordinates& location)
+{
+    return {
+        qFloor(location.x() / qreal(SIZE)) * SIZE,
+        qFloor(location.y() / qreal(SIZE)) * SIZE,
+    };
+}
+
+
+
+void GroundChunk::addTile(const TileCoordinates& location)
+{
+    auto& tile(tiles[getTileIndex(location)]);
+    if (tile.exists) {
+        return;
+    }
+
+    prepareGeometryChange();
+    tile = { true, true };
+    bounds |= QRectF(getGroundPosition(location), groundImage.getSize());
+    pixmap = QPixmap();
+}
+
+
+
+bool GroundChunk::hasTile(const TileCoordinates& location) const
+{
+    return tiles.at(getTileIndex(location)).exists;
+}
+
+
+
+void GroundChunk::setGroundVisible(const TileCoordinates& location, const bool isVisible)
+{
+    auto& tile(tiles[getTileIndex(location)]);
+    if (!tile.exists || tile.isGroundVisible == isVisible) {
+        return;
+    }
+
+    tile.isGroundVisible = isVisible;
+    if (!pixmap.isNull()) {
+        pixmap = QPixmap();
+        update();
+    }
+}
+
+
+
+void GroundChunk::releasePixmap()
+{
+    pixmap = QPixmap();
+}
+
+
+
+QRectF GroundChunk::boundingRect() const
+{
+    return bounds;
+}
+
+
+
+void GroundChunk::paint(QPainter* painter, const QStyleOptionGraphicsItem* /*option*/, QWidget* /*widget*/)
+{
+    auto newScaleLevel(qMin(Image::resolveScaleLevel(painter), MAX_SCALE_LEVEL));
+    if (pixmap.isNull() || newScaleLevel != scaleLevel) {
+        render(newScaleLevel);
+    }
+
+    painter->drawPixmap(bounds, pixmap, pixmap.rect());
+}
+
+
+
+int GroundChunk::getTileIndex(const TileCoordinates& location) const
+{
+    return (location.y() - origin.y()) * SIZE + location.x() - origin.x();
+}
+
+
+
+QPoint GroundChunk::getGroundPosition(const TileCoordinates& location) const
+{
+    return positioning.getTilePosition(location) +
+        positioning.getStaticElementPositionInTile(TileAreaSize(1), groundImage.getSize().height());
+}
+
+
+
+void GroundChunk::render(const int scaleLevel)
+{
+    this->scaleLevel = scaleLevel;
+    auto scale(1.0 / (1 << scaleLevel));
+    pixmap = QPixmap((bounds.size() * scale).toSize().expandedTo({ 1, 1 }));
+    pixmap.fill(Qt::transparent);
+
+    QPainter painter(&pixmap);
+    painter.setRenderHint(QPainter::SmoothPixmapTransform);
+    painter.scale(scale, scale);
+    painter.translate(-bounds.topLeft());
+    // The tiles are drawn line by line, from the top of the chunk to the bottom, where a line holds the tiles sharing the
+    // same difference between their coordinates.
+    for (int line(1 - SIZE); line < SIZE; ++line) {
+        for (int x(qMax(0, -line)); x < qMin(SIZE, SIZE - line); ++x) {
+            if (tiles.at((x + line) * SIZE + x).isGroundVisible) {
+                groundImage.draw(&painter, getGroundPosition({ origin.x() + x, origin.y() + x + line }));
+            }
+        }
+    }
+}
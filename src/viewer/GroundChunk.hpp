@@ -0,0 +1,69 @@
+#ifndef GROUNDCHUNK_HPP
+#define GROUNDCHUNK_HPP
+
+#include <QtCore/QVector>
+#include <QtGui/QPixmap>
+#include <QtWidgets/QGraphicsItem>
+
+#include "src/global/geometry/TileCoordinates.hpp"
+
+class Image;
+class Positioning;
+
+/**
+ * @brief Display the ground of a square of tiles of the map, prerendered into a single pixmap.
+ *
+ * The ground image is drawn under each tile of the chunk that does not display anything else. The pixmap is rendered
+ * the first time the chunk is painted, and rendered again only when the ground of a tile is hidden or revealed. It can
+ * be released while the chunk is out of sight.
+ *
+ * When the view is zoomed out, the pixmap is rendered at the scale of the view, rounded to a power of two, so that
+ * painting the chunk does not scale the full pixmap down each time.
+ */
+class GroundChunk : public QGraphicsItem
+{
+    public:
+        static const int SIZE;///< The quantity of tiles on each side of a chunk.
+
+    private:
+        struct Tile {
+            bool exists;
+            bool isGroundVisible;
+        };
+
+    private:
+        const Positioning& positioning;
+        const Image& groundImage;
+        const TileCoordinates origin;
+        QVector<Tile> tiles;
+        QRectF bounds;
+        QPixmap pixmap;
+        int scaleLevel;///< The power of two by which the pixmap is scaled down.
+
+    public:
+        GroundChunk(const Positioning& positioning, const Image& groundImage, const TileCoordinates& origin);
+
+        /**
+         * @brief Get the origin of the chunk holding the given tile.
+         */
+        static TileCoordinates resolveOrigin(const TileCoordinates& location);
+
+        void addTile(const TileCoordinates& location);
+        bool hasTile(const TileCoordinates& location) const;
+        void setGroundVisible(const TileCoordinates& location, const bool isVisible);
+
+        /**
+         * @brief Release the prerendered pixmap, it will be rendered again on the next paint.
+         */
+        void releasePixmap();
+
+        virtual QRectF boundingRect() const override;
+        virtual void paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget = nullptr) override;
+
+    private:
+        int getTileIndex(const TileCoordinates& location) const;
+        QPoint getGroundPosition(const TileCoordinates& location) const;
+        void render(const int scaleLevel);
+};
+
+#endif // GROUNDCHUNK_HPP
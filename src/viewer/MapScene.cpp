@@ -1,20 +1,27 @@
 #include "MapScene.hpp"
 
+#include <QtGui/QGuiApplication>
+#include <QtGui/QScreen>
+#include <QtCore/QtMath>
 #include <QtWidgets/QGraphicsSceneMouseEvent>
+#include <QtWidgets/QGraphicsSceneWheelEvent>
+#include <QtWidgets/QGraphicsView>
 
 #include "src/exceptions/OutOfRangeException.hpp"
 #include "src/global/conf/BuildingInformation.hpp"
 #include "src/global/conf/CharacterInformation.hpp"
 #include "src/global/conf/Conf.hpp"
 #include "src/global/conf/NatureElementInformation.hpp"
+#include "src/global/geometry/DynamicElementCoordinates.hpp"
+#include "src/global/geometry/TileArea.hpp"
 #include "src/global/geometry/TileAreaSize.hpp"
 #include "src/global/state/MapState.hpp"
 #include "src/global/state/NatureElementState.hpp"
 #include "src/global/state/State.hpp"
+#include "src/global/state/StateDelta.hpp"
 #include "src/ui/BuildingDetailsDialog.hpp"
 #include "src/ui/DialogDisplayer.hpp"
 #include "src/viewer/construction/ConstructionCursor.hpp"
-#include "src/viewer/element/graphics/DynamicElement.hpp"
 #include "src/viewer/element/graphics/StaticElement.hpp"
 #include "src/viewer/element/BuildingView.hpp"
 #include "src/viewer/element/CharacterView.hpp"
@@ -22,14 +29,28 @@
 #include "src/viewer/image/CharacterImage.hpp"
 #include "src/viewer/image/ImageLibrary.hpp"
 #include "src/viewer/image/NatureElementImage.hpp"
+#include "src/viewer/GroundChunk.hpp"
+#include "src/viewer/TileChunk.hpp"
 #include "src/viewer/TileView.hpp"
+#include "src/defines.hpp"
+
+const int ANIMATION_INTERVAL(100);
+const qreal MSEC_PER_SEC(1000);
+const qreal DEFAULT_REFRESH_RATE(60.0);
+const qreal MAX_STATE_INTERVAL(MSEC_PER_SEC);///< Longer intervals are pauses, they are not measured.
+const qreal STATE_INTERVAL_SMOOTHING(0.1);
+const qreal VISIBLE_AREA_MARGIN(256.0);///< Large enough to include the tallest images of the elements around the view.
+const qreal MIN_ZOOM(1.0 / 32.0);///< Small enough to display a whole city.
+const qreal MAX_ZOOM(2.0);
+const qreal ZOOM_FACTOR(1.25);///< The zoom change of each step of the mouse wheel.
+const qreal WHEEL_STEP(120.0);///< The angle of a step of the mouse wheel, in eighths of a degree.
 
 
 
 MapScene::MapScene(
     const Conf& conf,
-    const AreaCheckerInterface& areaChecker,
-    const RoadPathGeneratorInterface& roadPathGenerator,
+    AreaCheckerInterface& areaChecker,
+    RoadPathGeneratorInterface& roadPathGenerator,
     DialogDisplayer& dialogDisplayer,
     const MapState& mapState,
     const State& initialState
@@ -41,12 +62,25 @@ MapScene::MapScene(
     positioning(conf.getTileSize()),
     dialogDisplayer(dialogDisplayer),
     tiles(),
+    releasedTiles(),
+    groundChunks(),
+    tileChunks(),
     buildings(),
     characters(),
+    pendingBuildingStates(),
+    pendingCharacterStates(),
+    natureElements(),
     buildingLocationCache(),
     selectionElement(nullptr),
     animationClock(),
-    currentTileLocation(0, 0)
+    renderClock(),
+    stateTimer(),
+    stateInterval(MSEC_PER_SEC / CYCLES_PER_SECOND),
+    visibleArea(),
+    currentTileLocation(0, 0),
+    refreshGeneration(0),
+    overlayZValue(mapState.size.height()),
+    zoom(1.0)
 {
     setBackgroundBrush(QBrush(Qt::black));
 
@@ -54,7 +88,7 @@ MapScene::MapScene(
     auto& grassConf(conf.getNatureElementConf("grass"));
     auto& grassImage(imageLibrary.getNatureElementImage(grassConf));
 
-    // Create the tiles and their graphics item.
+    // Create the chunks of the ground. The tile views are created on demand.
     int line(0);
     int column(0);
     while (line < mapState.size.height()) {
@@ -64,14 +98,14 @@ MapScene::MapScene(
         int adjust(line > mapState.size.width() ? 1 : 2);
         while (column < (mapState.size.width() - line + adjust) / 2) {
             TileCoordinates coordinates(column, line + column);
-            auto tile(new TileView(
-                positioning,
-                coordinates,
-                *new StaticElement(positioning, TileAreaSize(1), grassImage.getImage())
-            ));
-
-            addItem(tile);
-            tiles.insert(coordinates.hash(), tile);
+            auto chunkOrigin(GroundChunk::resolveOrigin(coordinates));
+            auto groundChunk(groundChunks.value(chunkOrigin));
+            if (!groundChunk) {
+                groundChunk = new GroundChunk(positioning, grassImage.getImage(), chunkOrigin);
+                addItem(groundChunk);
+                groundChunks.insert(chunkOrigin, groundChunk);
+            }
+            groundChunk->addTile(coordinates);
 
             ++column;
         }
@@ -87,7 +121,11 @@ MapScene::MapScene(
         registerNewNatureElement(natureElementState);
     }
 
-    animationClock.start(100, this);
+    animationClock.start(ANIMATION_INTERVAL, this);
+
+    auto screen(QGuiApplication::primaryScreen());
+    auto refreshRate(screen && screen->refreshRate() > 0.0 ? screen->refreshRate() : DEFAULT_REFRESH_RATE);
+    renderClock.start(qRound(MSEC_PER_SEC / refreshRate), Qt::PreciseTimer, this);
 }
 
 
@@ -100,17 +138,40 @@ MapScene::~MapScene()
         delete selectionElement;
     }
     qDeleteAll(tiles);
+    qDeleteAll(tileChunks);
+    qDeleteAll(groundChunks);
 }
 
 
 
-TileView& MapScene::getTileAt(const TileCoordinates& location) const
+TileView& MapScene::getTileAt(const TileCoordinates& location)
 {
-    if (!tiles.contains(location.hash())) {
-        throw OutOfRangeException("Unable to find tile located at " + location.hash());
+    auto tile(tiles.value(location));
+    if (tile) {
+        return *tile;
+    }
+
+    tile = new TileView(positioning, location, getGroundChunkAt(location));
+    addItem(tile);
+    tiles.insert(location, tile);
+
+    return *tile;
+}
+
+
+
+void MapScene::releaseTile(TileView& tile)
+{
+    if (tile.isEmpty()) {
+        releasedTiles.insert(&tile);
     }
+}
+
 
-    return *tiles.value(location.hash());
+
+CharacterBatch& MapScene::getCharacterBatchAt(const TileCoordinates& location)
+{
+    return getTileChunkAt(location).getCharacterBatch();
 }
 
 
@@ -125,8 +186,9 @@ void MapScene::requestBuildingPositioning(const BuildingInformation& elementConf
         areaChecker,
         roadPathGenerator,
         elementConf,
-        imageLibrary.getBuildingImage(elementConf)
+        imageLibrary
     );
+    selectionElement->setZValue(overlayZValue);
     addItem(selectionElement);
     connect(selectionElement, &ConstructionCursor::cancel, [this]() {
         delete selectionElement;
@@ -154,12 +216,42 @@ void MapScene::requestBuildingRotation()
 
 
 
+void MapScene::updateConstructibility(const TileArea& area, bool isConstructible)
+{
+    if (selectionElement) {
+        selectionElement->updateConstructibility(area, isConstructible);
+    }
+}
+
+
+
+void MapScene::updateRoadPath(
+    const TileCoordinates& origin,
+    const TileCoordinates& target,
+    const QList<TileCoordinates>& path
+) {
+    if (selectionElement) {
+        selectionElement->updateRoadPath(origin, target, path);
+    }
+}
+
+
+
+void MapScene::centerOn(const TileCoordinates& location)
+{
+    for (auto view : views()) {
+        view->centerOn(positioning.getTilePosition(location));
+    }
+}
+
+
+
 void MapScene::registerNewBuilding(const BuildingState& buildingState)
 {
     auto buildingView(new BuildingView(positioning, *this, imageLibrary, buildingState));
     buildings.insert(buildingState.id, buildingView);
     for (auto coordinates : buildingState.area) {
-        buildingLocationCache.insert(coordinates.hash(), buildingView);
+        buildingLocationCache.insert(coordinates, buildingView);
     }
     if (selectionElement) {
         selectionElement->refresh();
@@ -180,6 +272,11 @@ void MapScene::registerNewCharacter(const CharacterState& characterState)
 
 void MapScene::registerNewNatureElement(const NatureElementState& natureElementState)
 {
+    if (natureElements.contains(natureElementState.id)) {
+        return;
+    }
+    natureElements.insert(natureElementState.id);
+
     auto& tile(getTileAt(natureElementState.area.leftCorner()));
     auto& natureElementImage(imageLibrary.getNatureElementImage(natureElementState.type));
 
@@ -195,52 +292,95 @@ void MapScene::registerNewNatureElement(const NatureElementState& natureElementS
 
 
 
-void MapScene::refresh(const State& state)
+void MapScene::refresh(const StateDelta& delta)
 {
-    auto buildingsToDestroy(buildings.keys());
-    for (auto& buildingState : state.buildings) {
-        if (buildings.contains(buildingState.id)) {
-            // Update existing building.
-            buildings.value(buildingState.id)->update(buildingState);
-            buildingsToDestroy.removeOne(buildingState.id);
+    // Note: Destroyed elements are processed first, since a new element may reuse the ID of a destroyed one.
+    if (delta.isFullResync) {
+        // A full resync lists all the elements as created: mark the views of the listed elements, then destroy all the
+        // views that have not been marked.
+        ++refreshGeneration;
+
+        for (auto& buildingState : delta.createdBuildings) {
+            auto buildingView(buildings.value(buildingState.id));
+            if (buildingView) {
+                buildingView->setRefreshGeneration(refreshGeneration);
+            }
         }
-        else {
-            // Create new building.
-            registerNewBuilding(buildingState);
+        auto buildingIterator(buildings.begin());
+        while (buildingIterator != buildings.end()) {
+            if (buildingIterator.value()->getRefreshGeneration() != refreshGeneration) {
+                pendingBuildingStates.remove(buildingIterator.key());
+                deleteBuildingView(buildingIterator.value());
+                buildingIterator = buildings.erase(buildingIterator);
+            }
+            else {
+                ++buildingIterator;
+            }
         }
-    }
-    for (auto buildingId : buildingsToDestroy) {
-        // Delete not found buildings.
-        buildings.value(buildingId)->destroy();
-        delete buildings.take(buildingId);
-    }
 
-    auto charactersToDestroy(characters.keys());
-    for (auto& characterState : state.characters) {
-        if (characters.contains(characterState.id)) {
-            // Update existing character.
-            characters.value(characterState.id)->update(characterState);
-            charactersToDestroy.removeOne(characterState.id);
+        for (auto& characterState : delta.createdCharacters) {
+            auto characterView(characters.value(characterState.id));
+            if (characterView) {
+                characterView->setRefreshGeneration(refreshGeneration);
+            }
         }
-        else {
-            // Create new character.
-            registerNewCharacter(characterState);
+        auto characterIterator(characters.begin());
+        while (characterIterator != characters.end()) {
+            if (characterIterator.value()->getRefreshGeneration() != refreshGeneration) {
+                pendingCharacterStates.remove(characterIterator.key());
+                deleteCharacterView(characterIterator.value());
+                characterIterator = characters.erase(characterIterator);
+            }
+            else {
+                ++characterIterator;
+            }
+        }
+    }
+    else {
+        for (auto buildingId : delta.destroyedBuildings) {
+            destroyBuilding(buildingId);
         }
+        for (auto characterId : delta.destroyedCharacters) {
+            destroyCharacter(characterId);
+        }
+    }
+
+    for (auto& natureElementState : delta.createdNatureElements) {
+        registerNewNatureElement(natureElementState);
+    }
+    for (auto& buildingState : delta.createdBuildings) {
+        updateBuilding(buildingState);
+    }
+    for (auto& buildingState : delta.changedBuildings) {
+        updateBuilding(buildingState);
     }
-    for (auto characterId : charactersToDestroy) {
-        // Delete not found characters.
-        characters.value(characterId)->destroy();
-        delete characters.take(characterId);
+    for (auto& characterState : delta.createdCharacters) {
+        updateCharacter(characterState);
     }
+    for (auto& characterState : delta.changedCharacters) {
+        updateCharacter(characterState);
+    }
+
+    measureStateInterval();
 }
 
 
 
-void MapScene::timerEvent(QTimerEvent* /*event*/)
+void MapScene::timerEvent(QTimerEvent* event)
 {
+    if (event->timerId() == renderClock.timerId()) {
+        imageLibrary.update();
+        updateVisibleArea();
+        interpolateCharacters();
+        return;
+    }
+
     for (auto building : buildings) {
-        building->advanceAnimation();
+        if (isInVisibleArea(building->getCurrentState().area)) {
+            building->advanceAnimation();
+        }
     }
+    recycleTiles();
 }
 
 
@@ -248,8 +388,8 @@ void MapScene::timerEvent(QTimerEvent* /*event*/)
 void MapScene::mouseReleaseEvent(QGraphicsSceneMouseEvent* event)
 {
     if (!selectionElement && event->button() == Qt::RightButton) {
-        auto buildingView(buildingLocationCache.value(currentTileLocation.hash()));
-        if (buildingView && buildingView->getCurrentState().type.getType() != BuildingInformation::Type::Road) {
+        auto buildingView(buildingLocationCache.value(currentTileLocation));
+        if (buildingView && buildingView->getCurrentState().getType().getType() != BuildingInformation::Type::Road) {
             displayBuildingDetailsDialog(buildingView->getCurrentState());
             return;
         }
@@ -273,6 +413,253 @@ void MapScene::mouseMoveEvent(QGraphicsSceneMouseEvent* event)
 
 
 
+GroundChunk& MapScene::getGroundChunkAt(const TileCoordinates& location) const
+{
+    auto groundChunk(groundChunks.value(GroundChunk::resolveOrigin(location)));
+    if (!groundChunk || !groundChunk->hasTile(location)) {
+        throw OutOfRangeException("Unable to find tile located at " + location.hash());
+    }
+
+    return *groundChunk;
+}
+
+
+
+TileChunk& MapScene::getTileChunkAt(const TileCoordinates& location)
+{
+    auto& groundChunk(getGroundChunkAt(location));
+    auto chunkOrigin(GroundChunk::resolveOrigin(location));
+    auto tileChunk(tileChunks.value(chunkOrigin));
+    if (!tileChunk) {
+        tileChunk = new TileChunk(positioning, *this, chunkOrigin, groundChunk.boundingRect());
+        tileChunks.insert(chunkOrigin, tileChunk);
+    }
+
+    return *tileChunk;
+}
+
+
+
+void MapScene::wheelEvent(QGraphicsSceneWheelEvent* event)
+{
+    event->accept();
+    auto newZoom(qBound(MIN_ZOOM, zoom * qPow(ZOOM_FACTOR, event->delta() / WHEEL_STEP), MAX_ZOOM));
+    if (newZoom == zoom) {
+        return;
+    }
+
+    for (auto view : views()) {
+        view->setTransformationAnchor(QGraphicsView::AnchorUnderMouse);
+        view->scale(newZoom / zoom, newZoom / zoom);
+    }
+    zoom = newZoom;
+}
+
+
+
+void MapScene::updateBuilding(const BuildingState& buildingState)
+{
+    auto buildingView(buildings.value(buildingState.id));
+    if (!buildingView) {
+        registerNewBuilding(buildingState);
+    }
+    else if (isInVisibleArea(buildingState.area)) {
+        pendingBuildingStates.remove(buildingState.id);
+        buildingView->update(buildingState);
+    }
+    else {
+        pendingBuildingStates.insert(buildingState.id, buildingState);
+    }
+}
+
+
+
+void MapScene::destroyBuilding(const quint64 buildingId)
+{
+    pendingBuildingStates.remove(buildingId);
+    auto buildingView(buildings.take(buildingId));
+    if (buildingView) {
+        deleteBuildingView(buildingView);
+    }
+}
+
+
+
+void MapScene::deleteBuildingView(owner<BuildingView*> buildingView)
+{
+    for (auto coordinates : buildingView->getCurrentState().area) {
+        if (buildingLocationCache.value(coordinates) == buildingView) {
+            buildingLocationCache.remove(coordinates);
+        }
+    }
+    buildingView->destroy();
+    delete buildingView;
+}
+
+
+
+void MapScene::updateCharacter(const CharacterState& characterState)
+{
+    auto characterView(characters.value(characterState.id));
+    if (!characterView) {
+        registerNewCharacter(characterState);
+    }
+    else if (isInVisibleArea(characterState.position)) {
+        pendingCharacterStates.remove(characterState.id);
+        characterView->update(characterState);
+    }
+    else {
+        pendingCharacterStates.insert(characterState.id, characterState);
+    }
+}
+
+
+
+void MapScene::destroyCharacter(const quint64 characterId)
+{
+    pendingCharacterStates.remove(characterId);
+    auto characterView(characters.take(characterId));
+    if (characterView) {
+        deleteCharacterView(characterView);
+    }
+}
+
+
+
+void MapScene::deleteCharacterView(owner<CharacterView*> characterView)
+{
+    characterView->destroy();
+    delete characterView;
+}
+
+
+
+void MapScene::measureStateInterval()
+{
+    if (stateTimer.isValid()) {
+        auto elapsed(stateTimer.restart());
+        if (elapsed < MAX_STATE_INTERVAL) {
+            stateInterval += (elapsed - stateInterval) * STATE_INTERVAL_SMOOTHING;
+        }
+    }
+    else {
+        stateTimer.start();
+    }
+}
+
+
+
+void MapScene::interpolateCharacters()
+{
+    if (!stateTimer.isValid()) {
+        return;
+    }
+
+    auto progress(qMin(stateTimer.elapsed() / stateInterval, 1.0));
+    for (auto character : characters) {
+        character->interpolate(progress);
+    }
+}
+
+
+
+void MapScene::updateVisibleArea()
+{
+    if (views().isEmpty()) {
+        visibleArea = QRectF();
+        return;
+    }
+
+    QRectF area;
+    for (auto view : views()) {
+        area |= view->mapToScene(view->viewport()->rect()).boundingRect();
+    }
+    area.adjust(-VISIBLE_AREA_MARGIN, -VISIBLE_AREA_MARGIN, VISIBLE_AREA_MARGIN, VISIBLE_AREA_MARGIN);
+    if (area == visibleArea) {
+        return;
+    }
+    visibleArea = area;
+
+    for (auto groundChunk : groundChunks) {
+        if (!visibleArea.intersects(groundChunk->boundingRect())) {
+            groundChunk->releasePixmap();
+        }
+    }
+
+    // Apply the states of the elements that entered the visible area.
+    auto buildingIterator(pendingBuildingStates.begin());
+    while (buildingIterator != pendingBuildingStates.end()) {
+        if (isInVisibleArea(buildingIterator.value().area)) {
+            buildings.value(buildingIterator.key())->update(buildingIterator.value());
+            buildingIterator = pendingBuildingStates.erase(buildingIterator);
+        }
+        else {
+            ++buildingIterator;
+        }
+    }
+    auto characterIterator(pendingCharacterStates.begin());
+    while (characterIterator != pendingCharacterStates.end()) {
+        if (isInVisibleArea(characterIterator.value().position)) {
+            characters.value(characterIterator.key())->update(characterIterator.value());
+            characterIterator = pendingCharacterStates.erase(characterIterator);
+        }
+        else {
+            ++characterIterator;
+        }
+    }
+}
+
+
+
+void MapScene::recycleTiles()
+{
+    auto iterator(releasedTiles.begin());
+    while (iterator != releasedTiles.end()) {
+        auto tile(*iterator);
+        if (!tile->isEmpty()) {
+            // Used again since it was released.
+            iterator = releasedTiles.erase(iterator);
+        }
+        else if (isInVisibleArea(TileArea(tile->coordinates(), TileAreaSize(1)))) {
+            ++iterator;
+        }
+        else {
+            iterator = releasedTiles.erase(iterator);
+            tiles.remove(tile->coordinates());
+            delete tile;
+        }
+    }
+}
+
+
+
+bool MapScene::isInVisibleArea(const TileArea& area) const
+{
+    if (visibleArea.isNull()) {
+        return true;
+    }
+
+    return visibleArea.intersects(
+        positioning.getBoundingRect(area.size()).translated(positioning.getTilePosition(area.leftCorner()))
+    );
+}
+
+
+
+bool MapScene::isInVisibleArea(const DynamicElementCoordinates& location) const
+{
+    if (visibleArea.isNull()) {
+        return true;
+    }
+
+    return visibleArea.contains(
+        positioning.getTilePosition(location.associatedTileCoordinates()) +
+        positioning.getDynamicElementPositionInTile(location)
+    );
+}
+
+
+
 void MapScene::displayBuildingDetailsDialog(const BuildingState& buildingState)
 {
     BuildingDetailsDialog dialog(buildingState);
@@ -2,10 +2,15 @@
 #define MAPSCENE_HPP
 
 #include <QtCore/QBasicTimer>
+#include <QtCore/QElapsedTimer>
 #include <QtCore/QHash>
+#include <QtCore/QRectF>
+#include <QtCore/QSet>
 #include <QtWidgets/QGraphicsScene>
 
 #include "src/global/geometry/TileCoordinates.hpp"
+#include "src/global/state/BuildingState.hpp"
+#include "src/global/state/CharacterState.hpp"
 #include "src/global/Direction.hpp"
 #include "src/viewer/element/TileLocatorInterface.hpp"
 #include "src/viewer/image/ImageLibrary.hpp"
@@ -15,51 +20,89 @@
 class AreaCheckerInterface;
 class BuildingInformation;
 class BuildingView;
+class CharacterBatch;
 class CharacterView;
 class Conf;
 class ConstructionCursor;
 class DialogDisplayer;
+class DynamicElementCoordinates;
+class GroundChunk;
 class RoadPathGeneratorInterface;
+class TileArea;
+class TileChunk;
 class TileView;
-struct BuildingState;
-struct CharacterState;
 struct MapState;
 struct NatureElementState;
 struct State;
+struct StateDelta;
 
 /**
  * @brief The scene used to display all the tiles (and their content).
+ *
+ * The scene is rendered at the refresh rate of the screen, independently of the rate of the simulation: between two
+ * states, the characters are interpolated according to the time elapsed since the last state, relatively to the
+ * measured interval between states.
+ *
+ * Only the elements in the visible area of the views (plus a margin) are kept up to date: the states of the other
+ * elements are kept aside and applied once they enter the visible area, and their animations do not advance.
+ *
+ * The ground is not made of one item per tile but of chunks of tiles, each prerendered into a pixmap. The pixmaps of
+ * the chunks out of the visible area are released. The tile views are only created when an element is displayed on
+ * them, and destroyed once they are empty and out of the visible area.
+ *
+ * The tile views and the elements they display do not move once added, so the scene keeps its default BSP index:
+ * painting and picking only walk through the items of the area concerned. The characters, which move all the time,
+ * are not items of the scene at all: each chunk draws its characters in a single batch (see TileChunk and
+ * CharacterBatch).
+ *
+ * The views are zoomed with the mouse wheel. The images are then drawn from prescaled mipmaps and, once zoomed out
+ * beyond the smallest mipmap, the buildings become flat diamonds and the characters dots (see Image).
  */
 class MapScene : public QGraphicsScene, public TileLocatorInterface
 {
         Q_OBJECT
 
     private:
-        const AreaCheckerInterface& areaChecker;
-        const RoadPathGeneratorInterface& roadPathGenerator;
+        AreaCheckerInterface& areaChecker;
+        RoadPathGeneratorInterface& roadPathGenerator;
         ImageLibrary imageLibrary;
         Positioning positioning;
         DialogDisplayer& dialogDisplayer;
-        QHash<QString, owner<TileView*>> tiles;
-        QHash<qintptr, owner<BuildingView*>> buildings;
-        QHash<qintptr, owner<CharacterView*>> characters;
-        QHash<QString, BuildingView*> buildingLocationCache; ///< A cache where key is a MapCoordinates has value.
+        QHash<TileCoordinates, owner<TileView*>> tiles;///< The tiles currently displaying something, or recently did.
+        QSet<TileView*> releasedTiles;///< The tiles to destroy once they are empty and out of sight.
+        QHash<TileCoordinates, owner<GroundChunk*>> groundChunks;///< The chunks of the ground, by their origin.
+        QHash<TileCoordinates, owner<TileChunk*>> tileChunks;///< The chunks holding the tiles, by their origin.
+        QHash<quint64, owner<BuildingView*>> buildings;
+        QHash<quint64, owner<CharacterView*>> characters;
+        QHash<quint64, BuildingState> pendingBuildingStates;///< The latest states of the buildings out of the visible area.
+        QHash<quint64, CharacterState> pendingCharacterStates;///< The latest states of the characters out of the visible area.
+        QSet<quint64> natureElements;
+        QHash<TileCoordinates, BuildingView*> buildingLocationCache; ///< The building covering each tile.
         optional<owner<ConstructionCursor*>> selectionElement;
         QBasicTimer animationClock;
+        QBasicTimer renderClock;
+        QElapsedTimer stateTimer;///< Measures the time elapsed since the last refresh.
+        qreal stateInterval;///< The average interval between two refreshes, in milliseconds.
+        QRectF visibleArea;///< The area of the scene displayed by the views, with a margin. Null when there is no view.
         TileCoordinates currentTileLocation;
+        int refreshGeneration;///< Incremented on each full resync to mark the views of the elements still in the state.
+        qreal overlayZValue;///< Above all the lines of tiles.
+        qreal zoom;///< The scale of the views.
 
     public:
         MapScene(
             const Conf& conf,
-            const AreaCheckerInterface& areaChecker,
-            const RoadPathGeneratorInterface& roadPathGenerator,
+            AreaCheckerInterface& areaChecker,
+            RoadPathGeneratorInterface& roadPathGenerator,
             DialogDisplayer& dialogDisplayer,
             const MapState& mapState,
             const State& initialState
         );
         ~MapScene();
 
-        virtual TileView& getTileAt(const TileCoordinates& location) const override;
+        virtual TileView& getTileAt(const TileCoordinates& location) override;
+        virtual void releaseTile(TileView& tile) override;
+        virtual CharacterBatch& getCharacterBatchAt(const TileCoordinates& location) override;
 
     public slots:
         /**
@@ -68,19 +111,38 @@ class MapScene : public QGraphicsScene, public TileLocatorInterface
         void requestBuildingPositioning(const BuildingInformation& elementConf);
         void requestBuildingRotation();
 
+        /**
+         * @brief Forward the answers to the queries of the building positioning tool, if still displayed.
+         */
+        void updateConstructibility(const TileArea& area, bool isConstructible);
+        void updateRoadPath(
+            const TileCoordinates& origin,
+            const TileCoordinates& target,
+            const QList<TileCoordinates>& path
+        );
+
+        /**
+         * @brief Center the views on the given location of the map.
+         */
+        void centerOn(const TileCoordinates& location);
+
         void registerNewBuilding(const BuildingState& buildingState);
         void registerNewCharacter(const CharacterState& characterState);
         void registerNewNatureElement(const NatureElementState& natureElementState);
 
         /**
-         * @brief Refresh the map.
+         * @brief Refresh the map with the changes of the state.
+         *
+         * A regular delta is applied in a time proportional to the number of changes. A full resync is reconciled in a
+         * single pass over the views, without comparing ID lists.
          */
-        void refresh(const State& state);
+        void refresh(const StateDelta& delta);
 
     protected:
         virtual void timerEvent(QTimerEvent* event) override;
         virtual void mouseReleaseEvent(QGraphicsSceneMouseEvent* event) override;
         virtual void mouseMoveEvent(QGraphicsSceneMouseEvent* event) override;
+        virtual void wheelEvent(QGraphicsSceneWheelEvent* event) override;
 
     signals:
         /**
@@ -97,6 +159,31 @@ class MapScene : public QGraphicsScene, public TileLocatorInterface
         );
 
     private:
+        /**
+         * @brief Return the ground chunk holding the given tile.
+         *
+         * @throws OutOfRangeException If the tile is out of the map.
+         */
+        GroundChunk& getGroundChunkAt(const TileCoordinates& location) const;
+
+        /**
+         * @brief Return the chunk holding the given tile, created if needed.
+         *
+         * @throws OutOfRangeException If the tile is out of the map.
+         */
+        TileChunk& getTileChunkAt(const TileCoordinates& location);
+        void updateBuilding(const BuildingState& buildingState);
+        void destroyBuilding(const quint64 buildingId);
+        void deleteBuildingView(owner<BuildingView*> buildingView);
+        void updateCharacter(const CharacterState& characterState);
+        void destroyCharacter(const quint64 characterId);
+        void deleteCharacterView(owner<CharacterView*> characterView);
+        void measureStateInterval();
+        void interpolateCharacters();
+        void updateVisibleArea();
+        void recycleTiles();
+        bool isInVisibleArea(const TileArea& area) const;
+        bool isInVisibleArea(const DynamicElementCoordinates& location) const;
         void displayBuildingDetailsDialog(const BuildingState& buildingState);
 };
 
@@ -0,0 +1,31 @@
+#include "TileChunk.hpp"
+
+#include "src/global/geometry/TileCoordinates.hpp"
+
+
+
+TileChunk::TileChunk(
+    const Positioning& positioning,
+    QGraphicsScene& scene,
+    const TileCoordinates& origin,
+    const QRectF& area
+) :
+    area(area),
+    characterBatch(positioning, scene, origin, area)
+{
+
+}
+
+
+
+const QRectF& TileChunk::getArea() const
+{
+    return area;
+}
+
+
+
+CharacterBatch& TileChunk::getCharacterBatch()
+{
+    return characterBatch;
+}
@@ -0,0 +1,49 @@
+#ifndef TILECHUNK_HPP
+#define TILECHUNK_HPP
+
+#include <QtCore/QRectF>
+
+#include "src/viewer/element/graphics/CharacterBatch.hpp"
+
+class Positioning;
+class QGraphicsScene;
+class TileCoordinates;
+
+/**
+ * @brief The characters walking on a chunk of the map, the same chunk as a ground chunk.
+ *
+ * The chunk is not an item of the scene. The tile views are top-level items, stacked line by line across the whole
+ * map: Qt only stacks sibling items, and the lines of the map cross the borders of the chunks. The characters walking
+ * on the chunk are drawn by its character batch, between the lines of tiles.
+ */
+class TileChunk
+{
+        Q_DISABLE_COPY_MOVE(TileChunk)
+
+    private:
+        QRectF area;
+        CharacterBatch characterBatch;
+
+    public:
+        /**
+         * @param origin The origin of the chunk in the map.
+         * @param area   The area covered by the ground of the chunk in the scene.
+         */
+        TileChunk(
+            const Positioning& positioning,
+            QGraphicsScene& scene,
+            const TileCoordinates& origin,
+            const QRectF& area
+        );
+
+        /**
+         * @brief Get the area covered by the ground of the chunk in the scene.
+         *
+         * The tall elements of the chunk may go beyond it.
+         */
+        const QRectF& getArea() const;
+
+        CharacterBatch& getCharacterBatch();
+};
+
+#endif // TILECHUNK_HPP
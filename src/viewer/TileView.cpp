@@ -1,21 +1,23 @@
 #include "TileView.hpp"
 
+#include "src/viewer/GroundChunk.hpp"
 #include "src/viewer/Positioning.hpp"
 
 
 
-TileView::TileView(const Positioning& positioning, const TileCoordinates& location, QGraphicsItem& groundElement) :
+TileView::TileView(const Positioning& positioning, const TileCoordinates& location, GroundChunk& groundChunk) :
     QGraphicsItem(),
     location(location),
-    groundElement(groundElement),
-    staticElement(nullptr)
+    groundChunk(groundChunk),
+    staticElement(nullptr),
+    isCovered(false)
 #ifdef DISPLAY_COORDINATES
     ,coordinatesElement(new QGraphicsSimpleTextItem(location.hash(), this))
 #endif
 {
-    setAcceptHoverEvents(true);
     setPos(positioning.getTilePosition(location));
-    groundElement.setParentItem(this);
+    // The tiles are stacked line by line, from the top of the map to the bottom.
+    setZValue(location.y() - location.x());
 #ifdef DISPLAY_COORDINATES
     coordinatesElement->setZValue(2.0);
     coordinatesElement->setPos(29 - coordinatesElement->boundingRect().width() / 2, 6);
@@ -31,48 +33,42 @@ const TileCoordinates& TileView::coordinates() const
 
 
 
-void TileView::setStaticElement(QGraphicsItem* staticElement)
+bool TileView::isEmpty() const
 {
-    if (this->staticElement) {
-        staticElement->setParentItem(nullptr);
-    }
-
-    this->staticElement = staticElement;
-    staticElement->setParentItem(this);
-
-    groundElement.setVisible(false);
+    return !isCovered && !staticElement;
 }
 
 
 
-void TileView::dropStaticElement()
+void TileView::setCovered(const bool isCovered)
 {
-    staticElement->setParentItem(nullptr);
-    staticElement = nullptr;
-
-    groundElement.setVisible(true);
+    this->isCovered = isCovered;
+    setVisible(!isCovered);
+    updateGround();
 }
 
 
 
-void TileView::registerDynamicElement(QGraphicsItem* element)
+void TileView::setStaticElement(QGraphicsItem* staticElement)
 {
-    element->setParentItem(this);
-    element->setVisible(true);
-}
-
+    if (this->staticElement) {
+        staticElement->setParentItem(nullptr);
+    }
 
+    this->staticElement = staticElement;
+    staticElement->setParentItem(this);
 
-void TileView::moveDynamicElementTo(QGraphicsItem* element, TileView& other)
-{
-    element->setParentItem(&other);
+    updateGround();
 }
 
 
 
-void TileView::unregisterDynamicElement(QGraphicsItem* element)
+void TileView::dropStaticElement()
 {
-    element->setParentItem(nullptr);
+    staticElement->setParentItem(nullptr);
+    staticElement = nullptr;
+
+    updateGround();
 }
 
 
@@ -83,7 +79,7 @@ QRectF TileView::boundingRect() const
         return staticElement->boundingRect();
     }
 
-    return groundElement.boundingRect();
+    return {};
 }
 
 
@@ -101,5 +97,12 @@ QPainterPath TileView::shape() const
         return staticElement->shape();
     }
 
-    return groundElement.shape();
+    return {};
+}
+
+
+
+void TileView::updateGround()
+{
+    groundChunk.setGroundVisible(location, !isCovered && !staticElement);
 }
@@ -6,40 +6,52 @@
 #include "src/global/geometry/TileCoordinates.hpp"
 #include "src/defines.hpp"
 
-class DynamicElement;
+class GroundChunk;
 class Positioning;
 class StaticElement;
 
 /**
  * @brief Display a tile on the map.
  *
- * The tile will hold a nature element, optionaly a building and several characters.
+ * The tile will hold a nature element or optionaly a building. The ground is not an item of the tile: it is drawn by the
+ * ground chunk of the tile, as long as the tile is not covered and has no static element. The characters are not items
+ * of the tiles either: they are drawn by the character batch of the tile chunk.
  */
 class TileView : public QGraphicsItem
 {
     private:
         TileCoordinates location;
-        QGraphicsItem& groundElement; ///< The ground nature element (grass for example).
+        GroundChunk& groundChunk; ///< The chunk drawing the ground nature element (grass for example).
         optional<QGraphicsItem*> staticElement; ///< The static element (building or nature element).
+        bool isCovered;
 #ifdef DISPLAY_COORDINATES
         QGraphicsSimpleTextItem* coordinatesElement;
 #endif
 
     public:
-        TileView(const Positioning& positioning, const TileCoordinates& location, QGraphicsItem& groundElement);
+        TileView(const Positioning& positioning, const TileCoordinates& location, GroundChunk& groundChunk);
 
         const TileCoordinates& coordinates() const;
 
+        /**
+         * @brief Whether the tile displays nothing but the ground.
+         */
+        bool isEmpty() const;
+
+        /**
+         * @brief Hide the tile, and its ground, under a static element of another tile.
+         */
+        void setCovered(const bool isCovered);
+
         void setStaticElement(QGraphicsItem* staticElement);
         void dropStaticElement();
 
-        void registerDynamicElement(QGraphicsItem* element);
-        void moveDynamicElementTo(QGraphicsItem* element, TileView& other);
-        void unregisterDynamicElement(QGraphicsItem* element);
-
         virtual QRectF boundingRect() const override;
         virtual void paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget = nullptr) override;
         virtual QPainterPath shape() const override;
+
+    private:
+        void updateGround();
 };
 
 #endif // TILEVIEW_HPP
@@ -8,7 +8,12 @@ class AreaCheckerInterface
     public:
         virtual ~AreaCheckerInterface() {};
 
-        virtual bool isConstructible(const TileArea& area) const = 0;
+        /**
+         * @brief Request to check if the area is constructible.
+         *
+         * The answer is delivered later, on the calling thread (see Engine::constructibilityChecked()).
+         */
+        virtual void requestConstructibilityCheck(const TileArea& area) = 0;
 };
 
 #endif // AREACHECKERINTERFACE_HPP
@@ -19,6 +19,7 @@ ConstructionCursor::Cursor::Cursor(
     const Positioning& positioning,
     Direction orientation,
     const QList<const BuildingAreaInformation::AreaPart*>& areaInformation,
+    const ImageLibrary& imageLibrary,
     const BuildingImage& buildingImage,
     const TileAreaSize& buildingSize
 ) :
@@ -29,10 +30,12 @@ ConstructionCursor::Cursor::Cursor(
 {
     int areaPartIndex(0);
     for (auto areaPart : areaInformation) {
-        auto& image(buildingImage.getAreaPartImage(orientation, areaPartIndex).getConstructionImage().getPixmap());
-        auto areaPartGraphics(new QGraphicsPixmapItem(image, this));
+        auto& image(imageLibrary.getConstructionImage(
+            buildingImage.getAreaPartImage(orientation, areaPartIndex).getInactiveImage()
+        ));
+        auto areaPartGraphics(new ImageItem(image, this));
         areaPartGraphics->setPos(
-            positioning.getStaticElementPositionInTile(areaPart->size, image.height(), areaPart->position)
+            positioning.getStaticElementPositionInTile(areaPart->size, image.getSize().height(), areaPart->position)
         );
         buildingGraphics.append(areaPartGraphics);
         ++areaPartIndex;
@@ -82,7 +85,7 @@ ConstructionCursor::RoadPath::RoadPath(
     const Positioning& positioning,
     QGraphicsItem* parent,
     const TileCoordinates& origin,
-    const QPixmap& image
+    const Image& image
 ) :
     positioning(positioning),
     parent(parent),
@@ -108,7 +111,7 @@ void ConstructionCursor::RoadPath::refreshPath(const QList<TileCoordinates>& pat
     resetPath();
     for (auto coordinates : path) {
         this->path.append(coordinates);
-        auto roadItem(new QGraphicsPixmapItem(image, parent));
+        auto roadItem(new ImageItem(image, parent));
         roadItem->setPos(positioning.getTilePosition(coordinates));
         graphics.append(roadItem);
     }
@@ -141,25 +144,28 @@ void ConstructionCursor::RoadPath::resetPath()
 
 ConstructionCursor::ConstructionCursor(
     const Positioning& positioning,
-    const AreaCheckerInterface& areaChecker,
-    const RoadPathGeneratorInterface& roadPathGenerator,
+    AreaCheckerInterface& areaChecker,
+    RoadPathGeneratorInterface& roadPathGenerator,
     const BuildingInformation& buildingConf,
-    const BuildingImage& buildingImage
+    const ImageLibrary& imageLibrary
 ) :
     QGraphicsObject(),
     positioning(positioning),
     areaChecker(areaChecker),
     roadPathGenerator(roadPathGenerator),
     buildingConf(buildingConf),
-    buildingImage(buildingImage),
+    imageLibrary(imageLibrary),
+    buildingImage(imageLibrary.getBuildingImage(buildingConf)),
     selectionType(buildingConf.getType() == BuildingInformation::Type::Road ? SelectionType::Road : SelectionType::Single),
     orientation(buildingConf.getAvailableOrientations().first()),
     coveredArea({ 0, 0 }, buildingConf.getSize(orientation)),
+    isCoveredAreaFree(false),
     cursor(new Cursor(
         this,
         positioning,
         orientation,
         buildingConf.getAreaParts(orientation),
+        imageLibrary,
         buildingImage,
         buildingConf.getSize(orientation)
     )),
@@ -207,6 +213,7 @@ void ConstructionCursor::rotateBuilding()
         positioning,
         orientation,
         buildingConf.getAreaParts(orientation),
+        imageLibrary,
         buildingImage,
         buildingConf.getSize(orientation)
     );
@@ -221,12 +228,42 @@ void ConstructionCursor::rotateBuilding()
 void ConstructionCursor::refresh()
 {
     // TODO: Handle road construction for checking area: allow finishing on a Road.
-    isCoveredAreaFree = areaChecker.isConstructible(coveredArea);
-    cursor->updateStatus(isCoveredAreaFree);
+    areaChecker.requestConstructibilityCheck(coveredArea);
 
     if (roadPath) {
-        roadPath->refreshPath(roadPathGenerator.getShortestPathForRoad(roadPath->getOrigin(), coveredArea.leftCorner()));
+        roadPathGenerator.requestShortestPathForRoad(roadPath->getOrigin(), coveredArea.leftCorner());
+    }
+}
+
+
+
+void ConstructionCursor::updateConstructibility(const TileArea& area, bool isConstructible)
+{
+    // The answers to the previous locations of the cursor are ignored.
+    if (
+        area.leftCorner() != coveredArea.leftCorner() ||
+        area.size().width() != coveredArea.size().width() ||
+        area.size().height() != coveredArea.size().height()
+    ) {
+        return;
+    }
+
+    isCoveredAreaFree = isConstructible;
+    cursor->updateStatus(isCoveredAreaFree);
+}
+
+
+
+void ConstructionCursor::updateRoadPath(
+    const TileCoordinates& origin,
+    const TileCoordinates& target,
+    const QList<TileCoordinates>& path
+) {
+    if (!roadPath || origin != roadPath->getOrigin() || target != coveredArea.leftCorner()) {
+        return;
     }
+
+    roadPath->refreshPath(path);
 }
 
 
@@ -261,7 +298,7 @@ void ConstructionCursor::mousePressEvent(QGraphicsSceneMouseEvent* event)
             positioning,
             this,
             coveredArea.leftCorner(),
-            buildingImage.getAreaPartImage(orientation, 0).getInactiveImage().getPixmap()
+            buildingImage.getAreaPartImage(orientation, 0).getInactiveImage()
         );
     }
 }
@@ -3,18 +3,20 @@
 
 #include <QtCore/QList>
 #include <QtWidgets/QGraphicsObject>
-#include <QtWidgets/QGraphicsPixmapItem>
 #include <QtWidgets/QGraphicsPolygonItem>
 
 #include "src/global/conf/BuildingAreaInformation.hpp"
 #include "src/global/geometry/TileArea.hpp"
 #include "src/global/geometry/TileCoordinates.hpp"
 #include "src/global/Direction.hpp"
+#include "src/viewer/element/graphics/ImageItem.hpp"
 #include "src/defines.hpp"
 
 class AreaCheckerInterface;
 class BuildingImage;
 class BuildingInformation;
+class Image;
+class ImageLibrary;
 class Positioning;
 class RoadPathGeneratorInterface;
 
@@ -30,7 +32,7 @@ class ConstructionCursor : public QGraphicsObject
 
         class Cursor : public QGraphicsItem {
             private:
-                QList<owner<QGraphicsPixmapItem*>> buildingGraphics;
+                QList<owner<ImageItem*>> buildingGraphics;
                 QGraphicsPolygonItem forbiddenAreaGraphics;
                 QRectF bounds;
 
@@ -40,6 +42,7 @@ class ConstructionCursor : public QGraphicsObject
                     const Positioning& positioning,
                     Direction orientation,
                     const QList<const BuildingAreaInformation::AreaPart*>& areaInformation,
+                    const ImageLibrary& imageLibrary,
                     const BuildingImage& buildingImage,
                     const TileAreaSize& buildingSize
                 );
@@ -55,17 +58,17 @@ class ConstructionCursor : public QGraphicsObject
             private:
                 const Positioning& positioning;
                 QGraphicsItem* parent;
-                const QPixmap& image;
+                const Image& image;
                 const TileCoordinates origin;
                 QList<TileCoordinates> path;
-                QList<owner<QGraphicsPixmapItem*>> graphics;
+                QList<owner<ImageItem*>> graphics;
 
             public:
                 RoadPath(
                     const Positioning& positioning,
                     QGraphicsItem* parent,
                     const TileCoordinates& origin,
-                    const QPixmap& image
+                    const Image& image
                 );
                 ~RoadPath();
 
@@ -80,9 +83,10 @@ class ConstructionCursor : public QGraphicsObject
 
     private:
         const Positioning& positioning;
-        const AreaCheckerInterface& areaChecker;
-        const RoadPathGeneratorInterface& roadPathGenerator;
+        AreaCheckerInterface& areaChecker;
+        RoadPathGeneratorInterface& roadPathGenerator;
         const BuildingInformation& buildingConf;
+        const ImageLibrary& imageLibrary;
         const BuildingImage& buildingImage;
         SelectionType selectionType;
         Direction orientation;
@@ -94,17 +98,37 @@ class ConstructionCursor : public QGraphicsObject
     public:
         ConstructionCursor(
             const Positioning& positioning,
-            const AreaCheckerInterface& areaChecker,
-            const RoadPathGeneratorInterface& roadPathGenerator,
+            AreaCheckerInterface& areaChecker,
+            RoadPathGeneratorInterface& roadPathGenerator,
             const BuildingInformation& buildingConf,
-            const BuildingImage& buildingImage
+            const ImageLibrary& imageLibrary
         );
         virtual ~ConstructionCursor();
 
         void displayAtLocation(const TileCoordinates& location);
         void rotateBuilding();
+
+        /**
+         * @brief Request the status of the covered area and the road path, if any.
+         *
+         * The cursor is updated once the answers are received, see updateConstructibility() and updateRoadPath().
+         */
         void refresh();
 
+        /**
+         * @brief Display the status of the covered area, unless the cursor has moved since the request.
+         */
+        void updateConstructibility(const TileArea& area, bool isConstructible);
+
+        /**
+         * @brief Display the road path, unless the cursor has moved since the request.
+         */
+        void updateRoadPath(
+            const TileCoordinates& origin,
+            const TileCoordinates& target,
+            const QList<TileCoordinates>& path
+        );
+
         virtual QRectF boundingRect() const override;
         virtual void paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget = nullptr) override;
 
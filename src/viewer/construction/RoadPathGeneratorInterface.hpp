@@ -1,8 +1,6 @@
 #ifndef ROADPATHGENERATORINTERFACE_HPP
 #define ROADPATHGENERATORINTERFACE_HPP
 
-#include <QtCore/QList>
-
 class TileCoordinates;
 
 class RoadPathGeneratorInterface
@@ -10,10 +8,12 @@ class RoadPathGeneratorInterface
     public:
         virtual ~RoadPathGeneratorInterface() {};
 
-        virtual QList<TileCoordinates> getShortestPathForRoad(
-            const TileCoordinates& origin,
-            const TileCoordinates& target
-        ) const = 0;
+        /**
+         * @brief Request the shortest path for a road between the two given locations.
+         *
+         * The answer is delivered later, on the calling thread (see Engine::shortestPathForRoadGenerated()).
+         */
+        virtual void requestShortestPathForRoad(const TileCoordinates& origin, const TileCoordinates& target) = 0;
 };
 
 #endif // ROADPATHGENERATORINTERFACE_HPP
@@ -17,7 +17,7 @@
 
 BuildingView::AreaPart::AreaPart(
     const Positioning& positioning,
-    const TileLocatorInterface& tileLocator,
+    TileLocatorInterface& tileLocator,
     const TileCoordinates& leftCorner,
     const TileAreaSize& size,
     const BuildingAreaPartImage& image
@@ -41,6 +41,7 @@ BuildingView::AreaPart::~AreaPart()
 {
     tile.dropStaticElement();
     revealCoveredTiles();
+    tileLocator.releaseTile(tile);
 }
 
 
@@ -79,7 +80,7 @@ void BuildingView::AreaPart::maskCoveredTiles()
         TileArea area(tile.coordinates(), size);
         auto iterator(area.beginAfterLeftCorner()), end(area.end());
         while (iterator != end) {
-            tileLocator.getTileAt(*iterator).setVisible(false);
+            tileLocator.getTileAt(*iterator).setCovered(true);
             ++iterator;
         }
     }
@@ -93,7 +94,9 @@ void BuildingView::AreaPart::revealCoveredTiles()
         TileArea area(tile.coordinates(), size);
         auto iterator(area.beginAfterLeftCorner()), end(area.end());
         while (iterator != end) {
-            tileLocator.getTileAt(*iterator).setVisible(true);
+            auto& coveredTile(tileLocator.getTileAt(*iterator));
+            coveredTile.setCovered(false);
+            tileLocator.releaseTile(coveredTile);
             ++iterator;
         }
     }
@@ -103,16 +106,17 @@ void BuildingView::AreaPart::revealCoveredTiles()
 
 BuildingView::BuildingView(
     const Positioning& positioning,
-    const TileLocatorInterface& tileLocator,
+    TileLocatorInterface& tileLocator,
     const ImageLibrary& imageLibrary,
     const BuildingState& state
 ) :
     areaParts(),
-    currentState(state)
+    currentState(state),
+    refreshGeneration(0)
 {
-    auto& buildingImage(imageLibrary.getBuildingImage(state.type));
+    auto& buildingImage(imageLibrary.getBuildingImage(state.getType()));
     int areaPartIndex(0);
-    for (auto areaPartConf : state.type.getAreaParts(state.orientation)) {
+    for (auto areaPartConf : state.getType().getAreaParts(state.orientation)) {
         areaParts.append(new AreaPart(
             positioning,
             tileLocator,
@@ -133,6 +137,20 @@ const BuildingState& BuildingView::getCurrentState() const
 
 
 
+int BuildingView::getRefreshGeneration() const
+{
+    return refreshGeneration;
+}
+
+
+
+void BuildingView::setRefreshGeneration(const int generation)
+{
+    refreshGeneration = generation;
+}
+
+
+
 void BuildingView::update(const BuildingState& state)
 {
     if (state.stateVersion != currentState.stateVersion) {
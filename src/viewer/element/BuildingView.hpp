@@ -27,7 +27,7 @@ class BuildingView
         class AreaPart
         {
             private:
-                const TileLocatorInterface& tileLocator;
+                TileLocatorInterface& tileLocator;
                 TileAreaSize size;
                 TileView& tile;
                 const BuildingAreaPartImage& image;
@@ -37,7 +37,7 @@ class BuildingView
             public:
                 AreaPart(
                     const Positioning& positioning,
-                    const TileLocatorInterface& tileLocator,
+                    TileLocatorInterface& tileLocator,
                     const TileCoordinates& leftCorner,
                     const TileAreaSize& size,
                     const BuildingAreaPartImage& image
@@ -55,16 +55,19 @@ class BuildingView
     private:
         QList<owner<AreaPart*>> areaParts;
         BuildingState currentState;
+        int refreshGeneration;///< The last refresh of the scene in which the building was part of the state.
 
     public:
         BuildingView(
             const Positioning& positioning,
-            const TileLocatorInterface& tileLocator,
+            TileLocatorInterface& tileLocator,
             const ImageLibrary& imageLibrary,
             const BuildingState& state
         );
 
         const BuildingState& getCurrentState() const;
+        int getRefreshGeneration() const;
+        void setRefreshGeneration(const int generation);
 
         void update(const BuildingState& state);
         void destroy();
@@ -1,41 +1,53 @@
 #include "CharacterView.hpp"
 
 #include "src/global/state/CharacterState.hpp"
-#include "src/viewer/element/graphics/DynamicElement.hpp"
+#include "src/viewer/element/graphics/CharacterBatch.hpp"
 #include "src/viewer/element/TileLocatorInterface.hpp"
 #include "src/viewer/image/CharacterImage.hpp"
 #include "src/viewer/image/ImageLibrary.hpp"
+#include "src/viewer/GroundChunk.hpp"
 #include "src/viewer/Positioning.hpp"
-#include "src/viewer/TileView.hpp"
 
 
 
 CharacterView::CharacterView(
     const Positioning& positioning,
-    const TileLocatorInterface& tileLocator,
+    TileLocatorInterface& tileLocator,
     const ImageLibrary& imageLibrary,
     const CharacterState& state
 ) :
     positioning(positioning),
     tileLocator(tileLocator),
-    currentTile(&tileLocator.getTileAt(state.position.associatedTileCoordinates())),
     image(imageLibrary.getCharacterImage(state.type)),
-    graphicElement(new DynamicElement(
-        positioning,
-        image.getAnimationImage(state.status, 0, state.direction),
-        state.position
-    )),
+    characterBatch(&tileLocator.getCharacterBatchAt(state.position.associatedTileCoordinates())),
+    spriteKey(-1),
+    currentTileLocation(state.position.associatedTileCoordinates()),
+    currentPosition(
+        positioning.getTilePosition(currentTileLocation) + positioning.getDynamicElementPositionInTile(state.position)
+    ),
+    currentImage(&image.getAnimationImage(state.status, 0, state.direction)),
+    previousLocation(state.position),
+    targetLocation(state.position),
+    displayedLocation(state.position),
     currentStateVersion(state.stateVersion),
-    animationIndex(0)
+    animationIndex(0),
+    refreshGeneration(0)
 {
-    currentTile->registerDynamicElement(graphicElement);
+    spriteKey = characterBatch->addSprite(currentTileLocation, currentPosition, *currentImage);
 }
 
 
 
-CharacterView::~CharacterView()
+int CharacterView::getRefreshGeneration() const
 {
-    delete graphicElement;
+    return refreshGeneration;
+}
+
+
+
+void CharacterView::setRefreshGeneration(const int generation)
+{
+    refreshGeneration = generation;
 }
 
 
@@ -43,9 +55,20 @@ CharacterView::~CharacterView()
 void CharacterView::update(const CharacterState& state)
 {
     if (state.stateVersion != currentStateVersion) {
-        move(state.position);
+        // The motion restarts from where the character is displayed, so it never jumps back. A character that went
+        // further than a neighbour tile is not interpolated, since the straight line may go through tiles it never
+        // walked on.
+        previousLocation = displayedLocation;
+        targetLocation = state.position;
+        if (
+            qAbs(targetLocation.x() - previousLocation.x()) > 1.0 ||
+            qAbs(targetLocation.y() - previousLocation.y()) > 1.0
+        ) {
+            previousLocation = targetLocation;
+        }
         advanceAnimation(state.status);
-        graphicElement->setImage(image.getAnimationImage(state.status, animationIndex, state.direction));
+        currentImage = &image.getAnimationImage(state.status, animationIndex, state.direction);
+        characterBatch->updateSprite(spriteKey, currentTileLocation, currentPosition, *currentImage);
 
         currentStateVersion = state.stateVersion;
     }
@@ -55,24 +78,46 @@ void CharacterView::update(const CharacterState& state)
 
 void CharacterView::destroy()
 {
-    currentTile->unregisterDynamicElement(graphicElement);
+    characterBatch->removeSprite(spriteKey);
+}
+
+
+
+void CharacterView::interpolate(const qreal progress)
+{
+    if (displayedLocation == targetLocation) {
+        return;
+    }
+
+    DynamicElementCoordinates location(
+        previousLocation.x() + (targetLocation.x() - previousLocation.x()) * progress,
+        previousLocation.y() + (targetLocation.y() - previousLocation.y()) * progress
+    );
+    move(location);
+    displayedLocation = location;
 }
 
 
 
 void CharacterView::move(const DynamicElementCoordinates& newLocation)
 {
-    auto& previousTileLocation(currentTile->coordinates());
     auto newTileLocation(newLocation.associatedTileCoordinates());
-
-    if (newTileLocation != previousTileLocation) {
-        // Move character to another tile.
-        auto& newTile(tileLocator.getTileAt(newTileLocation));
-        currentTile->moveDynamicElementTo(graphicElement, newTile);
-        currentTile = &newTile;
+    currentPosition =
+        positioning.getTilePosition(newTileLocation) + positioning.getDynamicElementPositionInTile(newLocation);
+
+    if (
+        newTileLocation != currentTileLocation &&
+        GroundChunk::resolveOrigin(newTileLocation) != GroundChunk::resolveOrigin(currentTileLocation)
+    ) {
+        // Move character to the batch of another chunk.
+        characterBatch->removeSprite(spriteKey);
+        characterBatch = &tileLocator.getCharacterBatchAt(newTileLocation);
+        spriteKey = characterBatch->addSprite(newTileLocation, currentPosition, *currentImage);
     }
-
-    graphicElement->updateLocation(positioning.getDynamicElementPositionInTile(newLocation));
+    else {
+        characterBatch->updateSprite(spriteKey, newTileLocation, currentPosition, *currentImage);
+    }
+    currentTileLocation = newTileLocation;
 }
 
 
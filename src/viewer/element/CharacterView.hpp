@@ -1,17 +1,19 @@
 #ifndef CHARACTERVIEW_HPP
 #define CHARACTERVIEW_HPP
 
+#include <QtCore/QPointF>
+
+#include "src/global/geometry/DynamicElementCoordinates.hpp"
+#include "src/global/geometry/TileCoordinates.hpp"
 #include "src/global/CharacterStatus.hpp"
-#include "src/defines.hpp"
 
 class Character;
+class CharacterBatch;
 class CharacterImage;
-class DynamicElement;
-class DynamicElementCoordinates;
+class Image;
 class ImageLibrary;
 class Positioning;
 class TileLocatorInterface;
-class TileView;
 struct CharacterState;
 
 /**
@@ -19,33 +21,55 @@ struct CharacterState;
  *
  * It keeps a weak pointer to the engine data of the character and knows all the logic needed to update the graphics
  * according to those data.
+ *
+ * The position of the character is not snapped to the location of the latest state: the view keeps the location it
+ * was displayed at when the state arrived and moves toward the new location on each render tick (see interpolate()), so
+ * that the motion stays smooth whatever the rate of the simulation.
+ *
+ * The character is not an item of the scene: it is a sprite of the character batch of the chunk it walks on.
  */
 class CharacterView
 {
     public:
         CharacterView(
             const Positioning& positioning,
-            const TileLocatorInterface& tileLocator,
+            TileLocatorInterface& tileLocator,
             const ImageLibrary& imageLibrary,
             const CharacterState& state
         );
-        ~CharacterView();
+
+        int getRefreshGeneration() const;
+        void setRefreshGeneration(const int generation);
 
         void update(const CharacterState& state);
         void destroy();
 
+        /**
+         * @brief Display the character between its previous location and the location of its latest state.
+         *
+         * @param progress The elapsed part of the state interval, from 0 (previous location) to 1 (latest location).
+         */
+        void interpolate(const qreal progress);
+
     private:
         void move(const DynamicElementCoordinates& newLocation);
         void advanceAnimation(CharacterStatus status);
 
     private:
         const Positioning& positioning;
-        const TileLocatorInterface& tileLocator;
-        TileView* currentTile;
+        TileLocatorInterface& tileLocator;
         const CharacterImage& image;
-        owner<DynamicElement*> graphicElement;
+        CharacterBatch* characterBatch;
+        int spriteKey;
+        TileCoordinates currentTileLocation;
+        QPointF currentPosition;///< The position of the feet of the character in the scene.
+        const Image* currentImage;
+        DynamicElementCoordinates previousLocation;
+        DynamicElementCoordinates targetLocation;
+        DynamicElementCoordinates displayedLocation;
         int currentStateVersion;
         int animationIndex;
+        int refreshGeneration;///< The last refresh of the scene in which the character was part of the state.
 };
 
 #endif // CHARACTERVIEW_HPP
@@ -1,6 +1,7 @@
 #ifndef TILEACCESSORINTERFACE_HPP
 #define TILEACCESSORINTERFACE_HPP
 
+class CharacterBatch;
 class TileCoordinates;
 class TileView;
 
@@ -8,9 +9,23 @@ class TileLocatorInterface
 {
     public:
         /**
-         * @brief Return the tile at the given location.
+         * @brief Return the tile at the given location, created if needed.
+         *
+         * The tile must be released once the caller does not display anything on it anymore.
          */
-        virtual TileView& getTileAt(const TileCoordinates& location) const = 0;
+        virtual TileView& getTileAt(const TileCoordinates& location) = 0;
+
+        /**
+         * @brief Indicate that the caller does not display anything on the tile anymore.
+         *
+         * An empty tile may then be destroyed once out of sight, it must not be used anymore.
+         */
+        virtual void releaseTile(TileView& tile) = 0;
+
+        /**
+         * @brief Return the batch drawing the characters of the chunk holding the given location.
+         */
+        virtual CharacterBatch& getCharacterBatchAt(const TileCoordinates& location) = 0;
 };
 
 #endif // TILEACCESSORINTERFACE_HPP
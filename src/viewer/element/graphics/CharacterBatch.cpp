@@ -0,0 +1,287 @@
+#include "CharacterBatch.hpp"
+
+#include <QtGui/QPainter>
+#include <QtWidgets/QGraphicsItem>
+#include <QtWidgets/QGraphicsScene>
+#include <QtWidgets/QStyleOptionGraphicsItem>
+
+#include "src/viewer/image/Image.hpp"
+#include "src/viewer/GroundChunk.hpp"
+#include "src/viewer/Positioning.hpp"
+
+const qreal SPRITE_MARGIN(256.0);///< Large enough to include the tallest images of the characters.
+const int LINE_SHIFT(16);///< The line takes the high bits of a depth key, the position in the line the low bits.
+const int MAX_LINE_DEPTH(0xFFFF);
+const qreal DEPTH_PRECISION(4.0);///< The steps of the position in the line, per pixel.
+const int RADIX_BITS(8);
+const int RADIX(1 << RADIX_BITS);
+const int KEY_BITS(32);
+const qreal DOT_SIZE(3.0);///< The size of the dot of a character on screen, when the view is zoomed out far.
+const QColor DOT_COLOR(Qt::white);
+
+
+
+/**
+ * @brief Draw the sprites of a line of the chunk, right above the tiles of the line in the whole scene.
+ */
+class CharacterBatch::Layer : public QGraphicsItem
+{
+    private:
+        CharacterBatch& batch;
+        const int line;
+        const QRectF bounds;
+
+    public:
+        Layer(CharacterBatch& batch, const int line, const QRectF& bounds) :
+            QGraphicsItem(),
+            batch(batch),
+            line(line),
+            bounds(bounds)
+        {
+            setZValue(batch.firstLine + line + 0.5);
+        }
+
+        virtual QRectF boundingRect() const override
+        {
+            return bounds;
+        }
+
+        virtual void paint(QPainter* painter, const QStyleOptionGraphicsItem* /*option*/, QWidget* /*widget*/) override
+        {
+            batch.paintLine(painter, line);
+        }
+};
+
+
+
+CharacterBatch::CharacterBatch(
+    const Positioning& positioning,
+    QGraphicsScene& scene,
+    const TileCoordinates& origin,
+    const QRectF& area
+) :
+    positioning(positioning),
+    scene(scene),
+    firstLine(origin.y() - origin.x() - (GroundChunk::SIZE - 1)),
+    bounds(area.adjusted(-SPRITE_MARGIN, -SPRITE_MARGIN, SPRITE_MARGIN, SPRITE_MARGIN)),
+    sprites(),
+    spriteKeys(),
+    keySprites(),
+    freeKeys(),
+    layers(2 * GroundChunk::SIZE - 1, nullptr),
+    lineSpriteCounts(2 * GroundChunk::SIZE - 1, 0),
+    lineBegins(2 * GroundChunk::SIZE - 1, 0),
+    drawOrder(),
+    sortBuffer(),
+    isDrawOrderValid(true)
+{
+
+}
+
+
+
+CharacterBatch::~CharacterBatch()
+{
+    qDeleteAll(layers);
+}
+
+
+
+int CharacterBatch::addSprite(const TileCoordinates& tile, const QPointF& position, const Image& image)
+{
+    int key;
+    if (!freeKeys.isEmpty()) {
+        key = freeKeys.takeLast();
+    }
+    else {
+        key = keySprites.size();
+        keySprites.append(-1);
+    }
+
+    keySprites[key] = sprites.size();
+    sprites.append({ position, &image, resolveDepthKey(tile, position) });
+    spriteKeys.append(key);
+    addToLine(sprites.last().depthKey >> LINE_SHIFT);
+    updateArea(sprites.last());
+    isDrawOrderValid = false;
+
+    return key;
+}
+
+
+
+void CharacterBatch::updateSprite(
+    const int key,
+    const TileCoordinates& tile,
+    const QPointF& position,
+    const Image& image
+) {
+    auto& sprite(sprites[keySprites.at(key)]);
+    if (sprite.position == position && sprite.image == &image) {
+        return;
+    }
+
+    updateArea(sprite);
+    auto depthKey(resolveDepthKey(tile, position));
+    if (depthKey != sprite.depthKey) {
+        if (depthKey >> LINE_SHIFT != sprite.depthKey >> LINE_SHIFT) {
+            removeFromLine(sprite.depthKey >> LINE_SHIFT);
+            addToLine(depthKey >> LINE_SHIFT);
+        }
+        isDrawOrderValid = false;
+    }
+    sprite = { position, &image, depthKey };
+    updateArea(sprite);
+}
+
+
+
+void CharacterBatch::removeSprite(const int key)
+{
+    auto index(keySprites.at(key));
+    updateArea(sprites.at(index));
+    removeFromLine(sprites.at(index).depthKey >> LINE_SHIFT);
+
+    // The last sprite takes the place of the removed one.
+    auto lastIndex(sprites.size() - 1);
+    if (index != lastIndex) {
+        sprites[index] = sprites.at(lastIndex);
+        spriteKeys[index] = spriteKeys.at(lastIndex);
+        keySprites[spriteKeys.at(index)] = index;
+    }
+    sprites.removeLast();
+    spriteKeys.removeLast();
+    isDrawOrderValid = false;
+
+    keySprites[key] = -1;
+    freeKeys.append(key);
+}
+
+
+
+quint32 CharacterBatch::resolveDepthKey(const TileCoordinates& tile, const QPointF& position) const
+{
+    quint32 line(tile.y() - tile.x() - firstLine);
+    quint32 lineDepth(qBound(
+        0,
+        qRound((position.y() - positioning.getTilePosition(tile).y()) * DEPTH_PRECISION),
+        MAX_LINE_DEPTH
+    ));
+
+    return line << LINE_SHIFT | lineDepth;
+}
+
+
+
+void CharacterBatch::addToLine(const int line)
+{
+    if (lineSpriteCounts[line]++ > 0) {
+        return;
+    }
+
+    auto layer(layers.at(line));
+    if (!layer) {
+        auto lineTop(positioning.getTilePosition({ 0, firstLine + line }).y());
+        auto lineBottom(positioning.getTilePosition({ 0, firstLine + line + 2 }).y());
+        layer = new Layer(
+            *this,
+            line,
+            { bounds.left(), lineTop - SPRITE_MARGIN, bounds.width(), lineBottom - lineTop + SPRITE_MARGIN }
+        );
+        scene.addItem(layer);
+        layers[line] = layer;
+    }
+    layer->setVisible(true);
+}
+
+
+
+void CharacterBatch::removeFromLine(const int line)
+{
+    if (--lineSpriteCounts[line] == 0) {
+        layers.at(line)->setVisible(false);
+    }
+}
+
+
+
+void CharacterBatch::updateArea(const Sprite& sprite)
+{
+    layers.at(sprite.depthKey >> LINE_SHIFT)->update(
+        { sprite.position + sprite.image->getPosition(), sprite.image->getSize() }
+    );
+}
+
+
+
+void CharacterBatch::sort()
+{
+    auto spriteCount(sprites.size());
+    drawOrder.resize(spriteCount);
+    sortBuffer.resize(spriteCount);
+    for (int i(0); i < spriteCount; ++i) {
+        drawOrder[i] = i;
+    }
+
+    // Least significant digit first: each pass is stable, so that the order of the previous digits is kept.
+    for (int shift(0); shift < KEY_BITS; shift += RADIX_BITS) {
+        int offsets[RADIX] = {};
+        int largestDigitCount(0);
+        for (auto index : drawOrder) {
+            auto& digitCount(offsets[(sprites.at(index).depthKey >> shift) & (RADIX - 1)]);
+            largestDigitCount = qMax(largestDigitCount, ++digitCount);
+        }
+        if (largestDigitCount == spriteCount) {
+            // All the sprites have the same digit.
+            continue;
+        }
+
+        int offset(0);
+        for (auto& digitOffset : offsets) {
+            auto digitCount(digitOffset);
+            digitOffset = offset;
+            offset += digitCount;
+        }
+        for (auto index : drawOrder) {
+            sortBuffer[offsets[(sprites.at(index).depthKey >> shift) & (RADIX - 1)]++] = index;
+        }
+        drawOrder.swap(sortBuffer);
+    }
+
+    int begin(0);
+    for (int line(0); line < lineBegins.size(); ++line) {
+        lineBegins[line] = begin;
+        begin += lineSpriteCounts.at(line);
+    }
+    isDrawOrderValid = true;
+}
+
+
+
+void CharacterBatch::paintLine(QPainter* painter, const int line)
+{
+    if (!isDrawOrderValid) {
+        sort();
+    }
+
+    auto end(lineBegins.at(line) + lineSpriteCounts.at(line));
+    if (Image::isSimplified(painter)) {
+        // Far out, the characters are dots of a constant size on screen.
+        auto dotSize(DOT_SIZE / QStyleOptionGraphicsItem::levelOfDetailFromTransform(painter->worldTransform()));
+        for (int i(lineBegins.at(line)); i < end; ++i) {
+            auto& position(sprites.at(drawOrder.at(i)).position);
+            painter->fillRect(
+                QRectF(position.x() - dotSize / 2.0, position.y() - dotSize, dotSize, dotSize),
+                DOT_COLOR
+            );
+        }
+        return;
+    }
+
+    for (int i(lineBegins.at(line)); i < end; ++i) {
+        auto& sprite(sprites.at(drawOrder.at(i)));
+        if (sprite.image->isReady()) {
+            sprite.image->draw(painter, sprite.position + sprite.image->getPosition());
+        }
+    }
+}
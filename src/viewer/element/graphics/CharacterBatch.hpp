@@ -0,0 +1,98 @@
+#ifndef CHARACTERBATCH_HPP
+#define CHARACTERBATCH_HPP
+
+#include <QtCore/QPointF>
+#include <QtCore/QRectF>
+#include <QtCore/QVector>
+
+#include "src/global/geometry/TileCoordinates.hpp"
+#include "src/defines.hpp"
+
+class Image;
+class Positioning;
+class QGraphicsScene;
+class QPainter;
+
+/**
+ * @brief Draw all the characters of a chunk of the map at once.
+ *
+ * A character is not an item of the scene: it is a sprite of the batch of the chunk it walks on, made of its position
+ * and its current image. The sprites are kept in a compact array, so moving a character only updates a record of the
+ * array and the area to repaint.
+ *
+ * Each sprite has a 32-bit depth key packing the line of its tile in the chunk and the position of its feet in the
+ * line. Each frame where a key changed, the sprites are sorted by depth with a radix sort, reusing the same buffers.
+ * The sprites of a line are then drawn by a layer, a top-level item of the scene stacked right above the tiles of this
+ * line, so that the characters go behind the static elements of the lines in front of them and in front of the others,
+ * whatever the chunk of these elements. A layer covers a fixed area, so the index of the scene only paints the layers
+ * of the visible area. The layers without any sprite are hidden.
+ *
+ * A sprite is referenced by a key that stays valid until the sprite is removed.
+ */
+class CharacterBatch
+{
+        Q_DISABLE_COPY_MOVE(CharacterBatch)
+
+    private:
+        class Layer;
+
+        struct Sprite {
+            QPointF position;///< The position of the feet of the character in the scene.
+            const Image* image;
+            quint32 depthKey;
+        };
+
+    private:
+        const Positioning& positioning;
+        QGraphicsScene& scene;
+        const int firstLine;///< The line of the tiles at the top of the chunk.
+        QRectF bounds;
+        QVector<Sprite> sprites;
+        QVector<int> spriteKeys;///< The key of each sprite.
+        QVector<int> keySprites;///< The index of the sprite of each key, -1 for free keys.
+        QVector<int> freeKeys;
+        QVector<owner<Layer*>> layers;///< The layer of each line, created when a sprite first goes on the line.
+        QVector<int> lineSpriteCounts;
+        QVector<int> lineBegins;///< The first sprite of each line in the draw order.
+        QVector<int> drawOrder;///< Reused between sorts.
+        QVector<int> sortBuffer;///< Reused between sorts.
+        bool isDrawOrderValid;
+
+    public:
+        /**
+         * @param scene  The scene the layers are added to.
+         * @param origin The origin of the chunk in the map.
+         * @param area   The area covered by the ground of the chunk in the scene.
+         */
+        CharacterBatch(
+            const Positioning& positioning,
+            QGraphicsScene& scene,
+            const TileCoordinates& origin,
+            const QRectF& area
+        );
+        ~CharacterBatch();
+
+        /**
+         * @param tile The location of the tile the character walks on.
+         *
+         * @return The key of the new sprite.
+         */
+        int addSprite(const TileCoordinates& tile, const QPointF& position, const Image& image);
+        void updateSprite(
+            const int key,
+            const TileCoordinates& tile,
+            const QPointF& position,
+            const Image& image
+        );
+        void removeSprite(const int key);
+
+    private:
+        quint32 resolveDepthKey(const TileCoordinates& tile, const QPointF& position) const;
+        void addToLine(const int line);
+        void removeFromLine(const int line);
+        void updateArea(const Sprite& sprite);
+        void sort();
+        void paintLine(QPainter* painter, const int line);
+};
+
+#endif // CHARACTERBATCH_HPP
@@ -0,0 +1,68 @@
+#include "ImageItem.hpp"
+
+#include <QtGui/QPainter>
+
+#include "src/viewer/image/Image.hpp"
+
+
+
+ImageItem::ImageItem(const Image& image, QGraphicsItem* parent) :
+    QGraphicsItem(parent),
+    image(&image),
+    isImageReady(image.isReady()),
+    isDetail(false)
+{
+
+}
+
+
+
+void ImageItem::setImage(const Image& image)
+{
+    if (&image == this->image && image.isReady() == isImageReady) {
+        return;
+    }
+
+    if (image.getSize() != this->image->getSize() || image.isReady() != isImageReady) {
+        prepareGeometryChange();
+    }
+    this->image = &image;
+    isImageReady = image.isReady();
+    update();
+}
+
+
+
+void ImageItem::setDetail(const bool isDetail)
+{
+    this->isDetail = isDetail;
+}
+
+
+
+QRectF ImageItem::boundingRect() const
+{
+    if (!isImageReady) {
+        return {};
+    }
+
+    return { QPointF(0.0, 0.0), image->getSize() };
+}
+
+
+
+void ImageItem::paint(QPainter* painter, const QStyleOptionGraphicsItem* /*option*/, QWidget* /*widget*/)
+{
+    if (!isImageReady || (isDetail && Image::isSimplified(painter))) {
+        return;
+    }
+
+    image->draw(painter, QPointF(0.0, 0.0));
+}
+
+
+
+const Image& ImageItem::getImage() const
+{
+    return *image;
+}
@@ -0,0 +1,39 @@
+#ifndef IMAGEITEM_HPP
+#define IMAGEITEM_HPP
+
+#include <QtWidgets/QGraphicsItem>
+
+class Image;
+
+/**
+ * @brief A graphics item displaying an image.
+ *
+ * Contrary to a QGraphicsPixmapItem, the item does not hold a pixmap of its own: it draws the area of the image in its
+ * atlas page, so that all the items share a few large pixmaps.
+ *
+ * An image that is not ready yet is not drawn. The item picks it up the next time the image is set.
+ *
+ * A detail item, like an animation over a building, is not drawn at all when the view is zoomed out so far that the
+ * elements are simplified.
+ */
+class ImageItem : public QGraphicsItem
+{
+    private:
+        const Image* image;
+        bool isImageReady;
+        bool isDetail;
+
+    public:
+        explicit ImageItem(const Image& image, QGraphicsItem* parent = nullptr);
+
+        void setImage(const Image& image);
+        void setDetail(const bool isDetail);
+
+        virtual QRectF boundingRect() const override;
+        virtual void paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget = nullptr) override;
+
+    protected:
+        const Image& getImage() const;
+};
+
+#endif // IMAGEITEM_HPP
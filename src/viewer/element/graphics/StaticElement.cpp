@@ -1,5 +1,7 @@
 #include "StaticElement.hpp"
 
+#include <QtGui/QPainter>
+
 #include "src/viewer/image/Image.hpp"
 #include "src/viewer/Positioning.hpp"
 
@@ -10,11 +12,14 @@ StaticElement::StaticElement(
     const TileAreaSize& elementSize,
     const Image& elementImage
 ) :
-    QGraphicsPixmapItem(elementImage.getPixmap()),
+    ImageItem(elementImage),
     shapePath(positioning.getTileAreaPainterPath(elementSize)),
+    simplifiedShape(),
     animationItem(nullptr)
 {
-    setPos(positioning.getStaticElementPositionInTile(elementSize, elementImage.getPixmap().height()));
+    setPos(positioning.getStaticElementPositionInTile(elementSize, elementImage.getSize().height()));
+    // The area polygon is relative to the tile.
+    simplifiedShape = positioning.getTileAreaPolygon(elementSize).translated(-pos());
 }
 
 
@@ -22,11 +27,11 @@ StaticElement::StaticElement(
 void StaticElement::setAnimationImage(const Image& image)
 {
     if (!animationItem) {
-        animationItem = new QGraphicsPixmapItem(this);
-        animationItem->setParentItem(this);
+        animationItem = new ImageItem(image, this);
+        animationItem->setDetail(true);
     }
     animationItem->setVisible(true);
-    animationItem->setPixmap(image.getPixmap());
+    animationItem->setImage(image);
     animationItem->setPos(image.getPosition());
 }
 
@@ -41,6 +46,22 @@ void StaticElement::dropAnimationImage()
 
 
 
+void StaticElement::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget)
+{
+    if (!Image::isSimplified(painter)) {
+        ImageItem::paint(painter, option, widget);
+        return;
+    }
+
+    if (getImage().isReady()) {
+        painter->setPen(Qt::NoPen);
+        painter->setBrush(getImage().getAverageColor());
+        painter->drawPolygon(simplifiedShape);
+    }
+}
+
+
+
 QPainterPath StaticElement::shape() const
 {
     return shapePath;
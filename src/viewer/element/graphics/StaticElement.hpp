@@ -1,19 +1,28 @@
 #ifndef STATICELEMENT_HPP
 #define STATICELEMENT_HPP
 
-#include <QtWidgets/QGraphicsPixmapItem>
+#include <QtGui/QPainterPath>
+#include <QtGui/QPolygonF>
 
+#include "src/viewer/element/graphics/ImageItem.hpp"
 #include "src/defines.hpp"
 
 class Image;
 class Positioning;
 class TileAreaSize;
 
-class StaticElement : public QGraphicsPixmapItem
+/**
+ * @brief A graphics item displaying the image of a building or a nature element, with an optional animation.
+ *
+ * When the view is zoomed out so far that the elements are simplified, the element is drawn as a flat diamond covering
+ * its area, filled with the average color of its image.
+ */
+class StaticElement : public ImageItem
 {
     private:
         QPainterPath shapePath;
-        optional<QGraphicsPixmapItem*> animationItem;
+        QPolygonF simplifiedShape;
+        optional<ImageItem*> animationItem;
 
     public:
         StaticElement(const Positioning& positioning, const TileAreaSize& elementSize, const Image& elementImage);
@@ -21,6 +30,7 @@ class StaticElement : public QGraphicsPixmapItem
         void setAnimationImage(const Image& image);
         void dropAnimationImage();
 
+        virtual void paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget = nullptr) override;
         virtual QPainterPath shape() const override;
 };
 
@@ -2,25 +2,24 @@
 
 #include "src/viewer/image/ImageSequence.hpp"
 
-ImageSequence BuildingAreaPartImage::EMPTY_ANIMATION({});
+ImageSequence BuildingAreaPartImage::EMPTY_ANIMATION;
 
 
 
-BuildingAreaPartImage::BuildingAreaPartImage(const BuildingAreaInformation::Graphics& graphicsConf, const QBrush& constructionBrush) :
-    mainImage(graphicsConf.mainImagePath),
-    constructionImage(mainImage, constructionBrush),
+BuildingAreaPartImage::BuildingAreaPartImage(ImageAtlas& atlas, const BuildingAreaInformation::Graphics& graphicsConf) :
+    mainImage(atlas, graphicsConf.mainImagePath),
     animations()
 {
     for (auto status : graphicsConf.animations.keys()) {
-        animations.insert(status, new ImageSequence(graphicsConf.animations.value(status)));
+        animations.insert(status, new ImageSequence(atlas, graphicsConf.animations.value(status)));
     }
 }
 
 
 
-const Image& BuildingAreaPartImage::getConstructionImage() const
+BuildingAreaPartImage::~BuildingAreaPartImage()
 {
-    return constructionImage;
+    qDeleteAll(animations);
 }
 
 
@@ -5,6 +5,7 @@
 #include "src/viewer/image/Image.hpp"
 #include "src/defines.hpp"
 
+class ImageAtlas;
 class ImageSequence;
 
 class BuildingAreaPartImage
@@ -14,13 +15,12 @@ class BuildingAreaPartImage
 
     private:
         const Image mainImage;
-        const Image constructionImage;
         QHash<BuildingStatus, owner<const ImageSequence*>> animations;
 
     public:
-        BuildingAreaPartImage(const BuildingAreaInformation::Graphics& graphicsConf, const QBrush& constructionBrush);
+        BuildingAreaPartImage(ImageAtlas& atlas, const BuildingAreaInformation::Graphics& graphicsConf);
+        ~BuildingAreaPartImage();
 
-        const Image& getConstructionImage() const;
         const Image& getInactiveImage() const;
         const ImageSequence& getActiveAnimationSequence(BuildingStatus status) const;
 };
@@ -5,13 +5,13 @@
 
 
 
-BuildingImage::BuildingImage(const BuildingInformation& buildingConf, const QBrush& constructionBrush) :
+BuildingImage::BuildingImage(ImageAtlas& atlas, const BuildingInformation& buildingConf) :
     areaParts()
 {
     for (auto orientation : buildingConf.getAvailableOrientations()) {
-        QList<const BuildingAreaPartImage*> areaParts;
+        QList<BuildingAreaPartImage*> areaParts;
         for (auto areaPartConf : buildingConf.getAreaParts(orientation)) {
-            areaParts.append(new BuildingAreaPartImage(areaPartConf->graphics, constructionBrush));
+            areaParts.append(new BuildingAreaPartImage(atlas, areaPartConf->graphics));
         }
         this->areaParts.insert(orientation, areaParts);
     }
@@ -19,6 +19,15 @@ BuildingImage::BuildingImage(const BuildingInformation& buildingConf, const QBru
 
 
 
+BuildingImage::~BuildingImage()
+{
+    for (auto& orientationAreaParts : areaParts) {
+        qDeleteAll(orientationAreaParts);
+    }
+}
+
+
+
 const BuildingAreaPartImage& BuildingImage::getAreaPartImage(Direction orientation, int areaIndex) const
 {
     return *areaParts.value(orientation).at(areaIndex);
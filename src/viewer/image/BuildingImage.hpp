@@ -8,7 +8,7 @@
 
 class BuildingAreaPartImage;
 class BuildingInformation;
-class QBrush;
+class ImageAtlas;
 
 /**
  * @brief Handles all the images required to display a building.
@@ -18,10 +18,11 @@ class BuildingImage
         Q_DISABLE_COPY_MOVE(BuildingImage)
 
     private:
-        QHash<Direction, QList<owner<const BuildingAreaPartImage*>>> areaParts;
+        QHash<Direction, QList<owner<BuildingAreaPartImage*>>> areaParts;
 
     public:
-        BuildingImage(const BuildingInformation& buildingConf, const QBrush& constructionBrush);
+        BuildingImage(ImageAtlas& atlas, const BuildingInformation& buildingConf);
+        ~BuildingImage();
 
         const BuildingAreaPartImage& getAreaPartImage(Direction orientation, int areaIndex) const;
 };
@@ -4,20 +4,20 @@
 
 
 
-CharacterImage::CharacterImage(const CharacterInformation::Graphics& graphicsData) :
+CharacterImage::CharacterImage(ImageAtlas& atlas, const CharacterInformation::Graphics& graphicsData) :
     animations()
 {
     for (auto status : graphicsData.animations.keys()) {
         auto& animationData(graphicsData.animations.value(status));
         CharacterStatusAnimation animation;
-        animation.insert(Direction::Top, new ImageSequence(animationData.value(Direction::Top)));
-        animation.insert(Direction::Right, new ImageSequence(animationData.value(Direction::Right)));
-        animation.insert(Direction::Bottom, new ImageSequence(animationData.value(Direction::Bottom)));
-        animation.insert(Direction::Left, new ImageSequence(animationData.value(Direction::Left)));
-        animation.insert(Direction::North, new ImageSequence(animationData.value(Direction::North)));
-        animation.insert(Direction::East, new ImageSequence(animationData.value(Direction::East)));
-        animation.insert(Direction::South, new ImageSequence(animationData.value(Direction::South)));
-        animation.insert(Direction::West, new ImageSequence(animationData.value(Direction::West)));
+        animation.insert(Direction::Top, new ImageSequence(atlas, animationData.value(Direction::Top)));
+        animation.insert(Direction::Right, new ImageSequence(atlas, animationData.value(Direction::Right)));
+        animation.insert(Direction::Bottom, new ImageSequence(atlas, animationData.value(Direction::Bottom)));
+        animation.insert(Direction::Left, new ImageSequence(atlas, animationData.value(Direction::Left)));
+        animation.insert(Direction::North, new ImageSequence(atlas, animationData.value(Direction::North)));
+        animation.insert(Direction::East, new ImageSequence(atlas, animationData.value(Direction::East)));
+        animation.insert(Direction::South, new ImageSequence(atlas, animationData.value(Direction::South)));
+        animation.insert(Direction::West, new ImageSequence(atlas, animationData.value(Direction::West)));
         animations.insert(status, animation);
     }
 }
@@ -50,5 +50,14 @@ const Image& CharacterImage::getAnimationImage(CharacterStatus status, int seque
         status = CharacterStatus::Walking;
     }
 
-    return animations.value(status).value(direction)->getImage(sequenceIndex);
+    auto& image(animations.value(status).value(direction)->getImage(sequenceIndex));
+    if (!image.isReady() && status != CharacterStatus::Walking && animations.contains(CharacterStatus::Walking)) {
+        // The walking animation stands in while the animation of the status is loading.
+        auto& walkingImage(animations.value(CharacterStatus::Walking).value(direction)->getImage(sequenceIndex));
+        if (walkingImage.isReady()) {
+            return walkingImage;
+        }
+    }
+
+    return image;
 }
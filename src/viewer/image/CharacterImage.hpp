@@ -8,6 +8,7 @@
 #include "src/viewer/image/Image.hpp"
 #include "src/defines.hpp"
 
+class ImageAtlas;
 class ImageSequence;
 
 using CharacterStatusAnimation = QHash<Direction, owner<const ImageSequence*>>;
@@ -20,10 +21,17 @@ class CharacterImage
         Q_DISABLE_COPY_MOVE(CharacterImage)
 
     public:
-        CharacterImage(const CharacterInformation::Graphics& graphicsData);
+        CharacterImage(ImageAtlas& atlas, const CharacterInformation::Graphics& graphicsData);
         ~CharacterImage();
 
         int getAnimationSequenceLength(CharacterStatus status) const;
+
+        /**
+         * @brief Get an image of the animation of a status.
+         *
+         * While the animation of the status is loading, an image of the walking animation is returned instead if it is
+         * ready. The returned image may not be ready yet.
+         */
         const Image& getAnimationImage(CharacterStatus status, int sequenceIndex, Direction direction) const;
 
     private:
@@ -1,39 +1,77 @@
 #include "Image.hpp"
 
-#include <QtGui/QBitmap>
+#include <cmath>
+#include <QtCore/QtMath>
 #include <QtGui/QPainter>
+#include <QtWidgets/QStyleOptionGraphicsItem>
 
-#include "src/exceptions/FileNotFoundException.hpp"
+const int Image::MIPMAP_LEVELS(2);
 
 
 
-Image::Image(const QString& path, const QPoint& position) :
-    pixmap(path),
-    position(position)
+Image::Image(ImageAtlas& atlas, const QString& path, const QPoint& position, const bool isLoaded) :
+    atlas(atlas),
+    index(atlas.registerImage(path)),
+    position(position),
+    mipmapKeys(MIPMAP_LEVELS),
+    averageColor()
 {
-    if (pixmap.isNull()) {
-        throw FileNotFoundException(path);
+    if (isLoaded) {
+        load();
     }
 }
 
 
 
-Image::Image(const Image& source, const QBrush& brush) :
-    pixmap(source.pixmap),
-    position(source.position)
+Image::Image(ImageAtlas& atlas, const Image& source, const QBrush& brush) :
+    atlas(atlas),
+    index(),
+    position(source.position),
+    mipmapKeys(MIPMAP_LEVELS),
+    averageColor()
 {
-    QRegion mask(QBitmap(QPixmap::fromImage(pixmap.toImage().createAlphaMask())));
-    QPainter painter(&pixmap);
-    painter.setClipRegion(mask);
-    painter.fillRect(pixmap.rect(), brush);
+    auto image(source.atlas.getImage(source.index));
+    QPainter painter(&image);
+    painter.setCompositionMode(QPainter::CompositionMode_SourceAtop);
+    painter.fillRect(image.rect(), brush);
     painter.end();
+
+    index = atlas.addImage(image);
+}
+
+
+
+void Image::load() const
+{
+    atlas.loadImage(index);
+}
+
+
+
+bool Image::isReady() const
+{
+    return atlas.isReady(index);
 }
 
 
 
-const QPixmap& Image::getPixmap() const
+const QPixmap& Image::getAtlasPage() const
 {
-    return pixmap;
+    return atlas.getPage(atlas.getRegion(index).page);
+}
+
+
+
+const QRect& Image::getAtlasRect() const
+{
+    return atlas.getRegion(index).rect;
+}
+
+
+
+QSize Image::getSize() const
+{
+    return atlas.getRegion(index).rect.size();
 }
 
 
@@ -42,3 +80,85 @@ const QPoint& Image::getPosition() const
 {
     return position;
 }
+
+
+
+void Image::draw(QPainter* painter, const QPointF& position) const
+{
+    auto level(qMin(resolveScaleLevel(painter), MIPMAP_LEVELS));
+    if (level == 0) {
+        painter->drawPixmap(position, getAtlasPage(), getAtlasRect());
+        return;
+    }
+
+    auto mipmap(getMipmap(level));
+    painter->drawPixmap(QRectF(position, getSize()), mipmap, mipmap.rect());
+}
+
+
+
+const QColor& Image::getAverageColor() const
+{
+    if (!averageColor.isValid()) {
+        auto image(getMipmap(MIPMAP_LEVELS).toImage().convertToFormat(QImage::Format_ARGB32_Premultiplied));
+        qint64 red(0);
+        qint64 green(0);
+        qint64 blue(0);
+        qint64 alpha(0);
+        for (int y(0); y < image.height(); ++y) {
+            for (int x(0); x < image.width(); ++x) {
+                auto pixel(image.pixel(x, y));
+                red += qRed(pixel);
+                green += qGreen(pixel);
+                blue += qBlue(pixel);
+                alpha += qAlpha(pixel);
+            }
+        }
+        // The colors are premultiplied, so that the transparent pixels do not count.
+        averageColor = alpha > 0 ?
+            QColor(red * 255 / alpha, green * 255 / alpha, blue * 255 / alpha) :
+            QColor(Qt::transparent);
+    }
+
+    return averageColor;
+}
+
+
+
+int Image::resolveScaleLevel(const QPainter* painter)
+{
+    auto levelOfDetail(QStyleOptionGraphicsItem::levelOfDetailFromTransform(painter->worldTransform()));
+    if (levelOfDetail >= 1.0) {
+        return 0;
+    }
+
+    return qFloor(std::log2(1.0 / levelOfDetail));
+}
+
+
+
+bool Image::isSimplified(const QPainter* painter)
+{
+    return resolveScaleLevel(painter) > MIPMAP_LEVELS;
+}
+
+
+
+QPixmap Image::getMipmap(const int level) const
+{
+    QPixmap mipmap;
+    auto& key(mipmapKeys[level - 1]);
+    if (!QPixmapCache::find(key, &mipmap)) {
+        // Each level is scaled down from the previous one, which is smoother than scaling the full image at once.
+        auto source(level == 1 ? getAtlasPage().copy(getAtlasRect()) : getMipmap(level - 1));
+        mipmap = source.scaled(
+            qMax(1, source.width() / 2),
+            qMax(1, source.height() / 2),
+            Qt::IgnoreAspectRatio,
+            Qt::SmoothTransformation
+        );
+        key = QPixmapCache::insert(mipmap);
+    }
+
+    return mipmap;
+}
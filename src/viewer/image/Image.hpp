@@ -2,38 +2,102 @@
 #define COLORABLEIMAGE_HPP
 
 #include <QtCore/QString>
+#include <QtCore/QVector>
 #include <QtGui/QBrush>
-#include <QtGui/QImage>
+#include <QtGui/QColor>
 #include <QtGui/QPixmap>
-#include <QtGui/QRegion>
+#include <QtGui/QPixmapCache>
+
+#include "src/viewer/image/ImageAtlas.hpp"
+
+class QPainter;
 
 /**
  * @brief A low-level class that handle an image.
  *
- * An Image is loaded from a file path and provide a pixmap and a position.
+ * An Image is loaded from a file path into an atlas and provide its area in the atlas and a position. It is drawn from
+ * its atlas page, once the atlas is finalized (see ImageItem).
+ *
+ * The image of a file can be created without being loaded: its file is only decoded the first time it is loaded. Until
+ * the atlas is updated with the decoded image, the image is not ready and has an empty size.
+ *
+ * When the view is zoomed out, the image is drawn from a prescaled variant instead of scaling the full image on each
+ * paint: the mipmaps halve the image size at each level. They are generated on demand and kept in the pixmap cache.
  */
 class Image
 {
         Q_DISABLE_COPY_MOVE(Image)
 
+    public:
+        static const int MIPMAP_LEVELS;
+
     private:
-        QPixmap pixmap;
+        ImageAtlas& atlas;
+        int index;
         QPoint position;
+        mutable QVector<QPixmapCache::Key> mipmapKeys;
+        mutable QColor averageColor;///< Invalid until it is computed.
 
     public:
         /**
-         * @brief Load an image from a file.
+         * @brief Create the image of a file in the atlas.
+         *
+         * @param isLoaded Whether to start loading the image right away.
          */
-        explicit Image(const QString& path, const QPoint& position = {});
+        Image(ImageAtlas& atlas, const QString& path, const QPoint& position = {}, const bool isLoaded = true);
 
         /**
          * @brief Create a colorized filter image using the source image as a shape pattern.
+         *
+         * The source image must be ready.
+         */
+        Image(ImageAtlas& atlas, const Image& source, const QBrush& brush);
+
+        /**
+         * @brief Start loading the image, if it is not ready yet.
+         */
+        void load() const;
+
+        bool isReady() const;
+
+        /**
+         * @brief Get the atlas page holding the image.
+         */
+        const QPixmap& getAtlasPage() const;
+
+        /**
+         * @brief Get the area of the image in its atlas page.
          */
-        Image(const Image& source, const QBrush& brush);
+        const QRect& getAtlasRect() const;
 
-        const QPixmap& getPixmap() const;
+        QSize getSize() const;
 
         const QPoint& getPosition() const;
+
+        /**
+         * @brief Draw the ready image, from the mipmap matching the scale of the painter.
+         */
+        void draw(QPainter* painter, const QPointF& position) const;
+
+        /**
+         * @brief Get the average color of the opaque pixels of the ready image.
+         */
+        const QColor& getAverageColor() const;
+
+        /**
+         * @brief Get the power of two by which the painter scales the images down, zero when it does not.
+         */
+        static int resolveScaleLevel(const QPainter* painter);
+
+        /**
+         * @brief Whether the painter scales the images down beyond the smallest mipmap.
+         *
+         * The elements should then be drawn simplified instead of with their images.
+         */
+        static bool isSimplified(const QPainter* painter);
+
+    private:
+        QPixmap getMipmap(const int level) const;
 };
 
 #endif // COLORABLEIMAGE_HPP
@@ -0,0 +1,404 @@
+#include "ImageAtlas.hpp"
+
+#include <cassert>
+#include <QtCore/QDataStream>
+#include <QtCore/QDebug>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QMutexLocker>
+#include <QtCore/QSaveFile>
+#include <QtCore/QStandardPaths>
+#include <QtCore/QThreadPool>
+#include <QtGui/QPainter>
+
+#include "src/exceptions/FileNotFoundException.hpp"
+
+const int PADDING(1);///< The space left between two images, so that they never bleed on each other when scaled.
+const quint32 CACHE_MAGIC_NUMBER(0x41544c53);
+const quint32 CACHE_VERSION(1);
+
+const int ImageAtlas::DEFAULT_PAGE_SIZE(2048);
+
+
+
+ImageAtlas::ImageAtlas(QThreadPool& decodingPool, const QString& cacheName, const int pageSize) :
+    decodingPool(decodingPool),
+    cacheName(cacheName),
+    pageSize(pageSize),
+    pageImages(),
+    pages(),
+    images(),
+    fileImages(),
+    cachedFileEntries(),
+    registeredCachedFileEntries(0),
+    isCacheStale(false),
+    isModified(false),
+    decodedImagesMutex(),
+    decodedImages(),
+    currentPage(-1),
+    shelfPosition(0, 0),
+    shelfHeight(0)
+{
+    if (!cacheName.isEmpty()) {
+        loadCache();
+    }
+}
+
+
+
+ImageAtlas::~ImageAtlas()
+{
+    if (cacheName.isEmpty()) {
+        return;
+    }
+
+    if (isCacheStale || registeredCachedFileEntries < cachedFileEntries.size()) {
+        // Some cached images are not used anymore or out of date: the cache is dropped, so that it is rebuilt without
+        // them on the next run.
+        removeCache();
+    }
+    else if (isModified) {
+        saveCache();
+    }
+}
+
+
+
+int ImageAtlas::registerImage(const QString& path)
+{
+    auto fileImage(fileImages.constFind(path));
+    if (fileImage != fileImages.constEnd()) {
+        return fileImage.value();
+    }
+
+    QFileInfo fileInfo(path);
+    if (!fileInfo.exists()) {
+        throw FileNotFoundException(path);
+    }
+    ImageEntry entry{ path, fileInfo.lastModified().toMSecsSinceEpoch(), fileInfo.size(), { -1, {} }, false, false };
+
+    auto cachedEntry(cachedFileEntries.constFind(path));
+    if (cachedEntry != cachedFileEntries.constEnd()) {
+        if (cachedEntry->lastModified == entry.lastModified && cachedEntry->size == entry.size) {
+            ++registeredCachedFileEntries;
+            entry.region = cachedEntry->region;
+        }
+        else {
+            isCacheStale = true;
+        }
+    }
+
+    images.append(entry);
+    fileImages.insert(path, images.size() - 1);
+
+    return images.size() - 1;
+}
+
+
+
+void ImageAtlas::loadImage(const int index)
+{
+    auto& entry(images[index]);
+    if (entry.region.page >= 0 || entry.isLoading || entry.hasFailed) {
+        return;
+    }
+
+    entry.isLoading = true;
+    auto path(entry.path);
+    decodingPool.start([this, index, path]() {
+        QImage image(path);
+        QMutexLocker locker(&decodedImagesMutex);
+        decodedImages.append({ index, image });
+    });
+}
+
+
+
+int ImageAtlas::addImage(const QImage& image)
+{
+    images.append({ QString(), 0, 0, pack(image), false, false });
+
+    return images.size() - 1;
+}
+
+
+
+bool ImageAtlas::update()
+{
+    return packDecodedImages(false);
+}
+
+
+
+void ImageAtlas::waitForImages()
+{
+    decodingPool.waitForDone();
+    packDecodedImages(true);
+}
+
+
+
+bool ImageAtlas::isReady(const int index) const
+{
+    return images.at(index).region.page >= 0;
+}
+
+
+
+const ImageAtlas::Region& ImageAtlas::getRegion(const int index) const
+{
+    return images.at(index).region;
+}
+
+
+
+QImage ImageAtlas::getImage(const int index) const
+{
+    auto& region(images.at(index).region);
+    assert(region.page >= 0);
+    if (pages.isEmpty()) {
+        return pageImages.at(region.page).copy(region.rect);
+    }
+
+    return pages.at(region.page).copy(region.rect).toImage();
+}
+
+
+
+void ImageAtlas::finalize()
+{
+    if (!pages.isEmpty()) {
+        return;
+    }
+
+    for (auto& pageImage : pageImages) {
+        pages.append(QPixmap::fromImage(pageImage));
+    }
+    pageImages.clear();
+}
+
+
+
+const QPixmap& ImageAtlas::getPage(const int page) const
+{
+    assert(!pages.isEmpty());
+
+    return pages.at(page);
+}
+
+
+
+bool ImageAtlas::packDecodedImages(const bool throwOnFailure)
+{
+    QList<DecodedImage> newImages;
+    {
+        QMutexLocker locker(&decodedImagesMutex);
+        newImages.swap(decodedImages);
+    }
+
+    bool hasNewImages(false);
+    for (auto& decodedImage : newImages) {
+        auto& entry(images[decodedImage.index]);
+        entry.isLoading = false;
+        if (decodedImage.image.isNull()) {
+            if (throwOnFailure) {
+                throw FileNotFoundException(entry.path);
+            }
+            qDebug() << "WARNING: Unable to decode the image file" << entry.path << ". The image is not displayed.";
+            entry.hasFailed = true;
+            continue;
+        }
+        entry.region = pack(decodedImage.image);
+        isModified = true;
+        hasNewImages = true;
+    }
+
+    return hasNewImages;
+}
+
+
+
+ImageAtlas::Region ImageAtlas::pack(const QImage& image)
+{
+    auto isFinalized(!pages.isEmpty());
+    auto currentPageSize(
+        currentPage < 0 ? QSize() :
+        isFinalized ? pages.at(currentPage).size() :
+        pageImages.at(currentPage).size()
+    );
+    QSize paddedSize(image.width() + PADDING, image.height() + PADDING);
+    if (currentPage >= 0 && shelfPosition.x() + paddedSize.width() > currentPageSize.width()) {
+        // Start a new shelf below the current one.
+        shelfPosition = { 0, shelfPosition.y() + shelfHeight };
+        shelfHeight = 0;
+    }
+    if (
+        currentPage < 0 ||
+        paddedSize.width() > currentPageSize.width() ||
+        shelfPosition.y() + paddedSize.height() > currentPageSize.height()
+    ) {
+        // Start a new page, large enough for the image.
+        QImage page(
+            qMax(pageSize, paddedSize.width()),
+            qMax(pageSize, paddedSize.height()),
+            QImage::Format_ARGB32_Premultiplied
+        );
+        page.fill(Qt::transparent);
+        if (isFinalized) {
+            pages.append(QPixmap::fromImage(page));
+            currentPage = pages.size() - 1;
+        }
+        else {
+            pageImages.append(page);
+            currentPage = pageImages.size() - 1;
+        }
+        shelfPosition = { 0, 0 };
+        shelfHeight = 0;
+    }
+
+    Region region{ currentPage, { shelfPosition, image.size() } };
+    QPainter painter;
+    if (isFinalized) {
+        painter.begin(&pages[currentPage]);
+    }
+    else {
+        painter.begin(&pageImages[currentPage]);
+    }
+    painter.setCompositionMode(QPainter::CompositionMode_Source);
+    painter.drawImage(region.rect.topLeft(), image);
+    painter.end();
+
+    shelfPosition.rx() += paddedSize.width();
+    shelfHeight = qMax(shelfHeight, paddedSize.height());
+
+    return region;
+}
+
+
+
+QString ImageAtlas::getCacheDirectoryPath() const
+{
+    return QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/atlas";
+}
+
+
+
+QString ImageAtlas::getCacheIndexPath() const
+{
+    return getCacheDirectoryPath() + "/" + cacheName + ".index";
+}
+
+
+
+QString ImageAtlas::getCachePagePath(const int page) const
+{
+    return getCacheDirectoryPath() + "/" + cacheName + "-" + QString::number(page) + ".png";
+}
+
+
+
+void ImageAtlas::loadCache()
+{
+    QFile indexFile(getCacheIndexPath());
+    if (!indexFile.open(QIODevice::ReadOnly)) {
+        return;
+    }
+
+    QDataStream stream(&indexFile);
+    stream.setVersion(QDataStream::Qt_5_15);
+    quint32 magicNumber;
+    quint32 version;
+    qint32 pageCount;
+    qint32 entryCount;
+    stream >> magicNumber >> version >> pageCount >> entryCount;
+    if (
+        stream.status() != QDataStream::Ok ||
+        magicNumber != CACHE_MAGIC_NUMBER ||
+        version != CACHE_VERSION ||
+        pageCount < 0 ||
+        entryCount < 0
+    ) {
+        return;
+    }
+
+    QHash<QString, CachedFileEntry> entries;
+    for (int i(0); i < entryCount; ++i) {
+        QString path;
+        CachedFileEntry entry;
+        stream >> path >> entry.lastModified >> entry.size >> entry.region.page >> entry.region.rect;
+        entries.insert(path, entry);
+    }
+    if (stream.status() != QDataStream::Ok) {
+        return;
+    }
+
+    QList<QImage> cachedPages;
+    for (int page(0); page < pageCount; ++page) {
+        QImage image(getCachePagePath(page));
+        if (image.isNull()) {
+            return;
+        }
+        cachedPages.append(image.convertToFormat(QImage::Format_ARGB32_Premultiplied));
+    }
+
+    // A region out of its page means the index and the pages do not match: the whole cache is dropped.
+    for (auto& entry : entries) {
+        auto& region(entry.region);
+        if (
+            region.page < 0 ||
+            region.page >= cachedPages.size() ||
+            !cachedPages.at(region.page).rect().contains(region.rect)
+        ) {
+            return;
+        }
+    }
+
+    // New images are never packed into the cached pages, the next image will start a new page.
+    pageImages = cachedPages;
+    cachedFileEntries = entries;
+}
+
+
+
+void ImageAtlas::saveCache() const
+{
+    if (!QDir().mkpath(getCacheDirectoryPath())) {
+        return;
+    }
+
+    auto pageCount(pages.isEmpty() ? pageImages.size() : pages.size());
+    for (int page(0); page < pageCount; ++page) {
+        auto pageImage(pages.isEmpty() ? pageImages.at(page) : pages.at(page).toImage());
+        if (!pageImage.save(getCachePagePath(page), "PNG")) {
+            return;
+        }
+    }
+
+    QList<const ImageEntry*> fileEntries;
+    for (auto& entry : images) {
+        if (!entry.path.isEmpty() && entry.region.page >= 0) {
+            fileEntries.append(&entry);
+        }
+    }
+
+    QSaveFile indexFile(getCacheIndexPath());
+    if (!indexFile.open(QIODevice::WriteOnly)) {
+        return;
+    }
+
+    QDataStream stream(&indexFile);
+    stream.setVersion(QDataStream::Qt_5_15);
+    stream << CACHE_MAGIC_NUMBER << CACHE_VERSION << qint32(pageCount) << qint32(fileEntries.size());
+    for (auto entry : fileEntries) {
+        stream << entry->path << entry->lastModified << entry->size << entry->region.page << entry->region.rect;
+    }
+    indexFile.commit();
+}
+
+
+
+void ImageAtlas::removeCache() const
+{
+    QFile::remove(getCacheIndexPath());
+}
@@ -0,0 +1,174 @@
+#ifndef IMAGEATLAS_HPP
+#define IMAGEATLAS_HPP
+
+#include <QtCore/QHash>
+#include <QtCore/QList>
+#include <QtCore/QMutex>
+#include <QtCore/QRect>
+#include <QtCore/QString>
+#include <QtCore/QVector>
+#include <QtGui/QImage>
+#include <QtGui/QPixmap>
+
+class QThreadPool;
+
+/**
+ * @brief A set of large pages packing many small images, so that they are drawn from a few pixmaps.
+ *
+ * The images of files are added in two steps. An image is first registered, which only checks its file. It is then
+ * loaded on demand: its file is decoded on the thread pool and the decoded image is packed into the pages by the next
+ * update of the atlas, in the GUI thread. Until then, the image is not ready and has no region in the atlas. An image
+ * whose file cannot be decoded never becomes ready.
+ *
+ * The images are packed into the pages with a shelf algorithm. Once the atlas is finalized, the pages are turned into
+ * pixmaps: the images loaded afterwards are drawn directly into the pixmaps.
+ *
+ * An atlas with a name is cached on disk. The cache is loaded when the atlas is created: an image file that did not
+ * change since is ready as soon as it is registered, without being decoded again. The cache is saved with all the
+ * images loaded during the run when the atlas is destroyed.
+ */
+class ImageAtlas
+{
+        Q_DISABLE_COPY_MOVE(ImageAtlas)
+
+    public:
+        static const int DEFAULT_PAGE_SIZE;
+
+        /**
+         * @brief The location of an image in the atlas.
+         */
+        struct Region {
+            int page;///< -1 while the image is not loaded.
+            QRect rect;
+        };
+
+    private:
+        struct ImageEntry {
+            QString path;///< Empty for an image that was not loaded from a file.
+            qint64 lastModified;
+            qint64 size;
+            Region region;
+            bool isLoading;
+            bool hasFailed;///< The file could not be decoded, it is never loaded again.
+        };
+
+        struct CachedFileEntry {
+            qint64 lastModified;
+            qint64 size;
+            Region region;
+        };
+
+        struct DecodedImage {
+            int index;
+            QImage image;
+        };
+
+    private:
+        QThreadPool& decodingPool;
+        const QString cacheName;
+        const int pageSize;
+        QList<QImage> pageImages;///< The pages until the atlas is finalized.
+        QList<QPixmap> pages;///< The pages once the atlas is finalized.
+        QVector<ImageEntry> images;
+        QHash<QString, int> fileImages;///< The index of the image of each file.
+        QHash<QString, CachedFileEntry> cachedFileEntries;///< The image files found in the cache, by path.
+        int registeredCachedFileEntries;
+        bool isCacheStale;///< Whether the cache holds images that are not used anymore or out of date.
+        bool isModified;
+        QMutex decodedImagesMutex;
+        QList<DecodedImage> decodedImages;///< The images decoded by the thread pool, waiting to be packed.
+        int currentPage;///< The page where images are packed, -1 until a page is created.
+        QPoint shelfPosition;
+        int shelfHeight;
+
+    public:
+        /**
+         * @brief Create an atlas, loaded from the cache if a cache name is given.
+         *
+         * @param decodingPool The pool decoding the image files. It must wait for all its tasks before the atlas is
+         *                     destroyed.
+         * @param pageSize     The minimal size of the pages. With zero, each image gets a page of its own size.
+         */
+        explicit ImageAtlas(
+            QThreadPool& decodingPool,
+            const QString& cacheName = QString(),
+            const int pageSize = DEFAULT_PAGE_SIZE
+        );
+
+        /**
+         * @brief Save the cache if the atlas has a name.
+         */
+        ~ImageAtlas();
+
+        /**
+         * @brief Register the image of a file, without decoding it.
+         *
+         * Registering the same file twice returns the same image.
+         *
+         * @throws FileNotFoundException If the file does not exist.
+         * @return The index of the image in the atlas.
+         */
+        int registerImage(const QString& path);
+
+        /**
+         * @brief Start to decode a registered image on the thread pool, if it is not ready nor loading already.
+         *
+         * An image whose file could not be decoded is not loaded again.
+         */
+        void loadImage(const int index);
+
+        /**
+         * @brief Pack an image into the atlas right away.
+         *
+         * @return The index of the image in the atlas.
+         */
+        int addImage(const QImage& image);
+
+        /**
+         * @brief Pack the images decoded since the last update into the pages.
+         *
+         * A file that is not a valid image is only reported as a warning: the update may happen at any time while the
+         * map is displayed.
+         *
+         * @return Whether some images became ready.
+         */
+        bool update();
+
+        /**
+         * @brief Wait for all the images being decoded and pack them into the pages.
+         *
+         * @throws FileNotFoundException If a file is not a valid image.
+         */
+        void waitForImages();
+
+        bool isReady(const int index) const;
+
+        const Region& getRegion(const int index) const;
+
+        /**
+         * @brief Get a copy of a ready image of the atlas.
+         */
+        QImage getImage(const int index) const;
+
+        /**
+         * @brief Turn the pages into pixmaps.
+         */
+        void finalize();
+
+        const QPixmap& getPage(const int page) const;
+
+    private:
+        /**
+         * @brief Pack the decoded images, either throwing or warning about the files that are not valid images.
+         */
+        bool packDecodedImages(const bool throwOnFailure);
+        Region pack(const QImage& image);
+        QString getCacheDirectoryPath() const;
+        QString getCacheIndexPath() const;
+        QString getCachePagePath(const int page) const;
+        void loadCache();
+        void saveCache() const;
+        void removeCache() const;
+};
+
+#endif // IMAGEATLAS_HPP
@@ -1,5 +1,7 @@
 #include "ImageLibrary.hpp"
 
+#include <QtGui/QPixmapCache>
+
 #include "src/exceptions/OutOfRangeException.hpp"
 #include "src/global/conf/BuildingInformation.hpp"
 #include "src/global/conf/CharacterInformation.hpp"
@@ -7,42 +9,86 @@
 #include "src/global/conf/NatureElementInformation.hpp"
 #include "src/viewer/image/BuildingImage.hpp"
 #include "src/viewer/image/CharacterImage.hpp"
+#include "src/viewer/image/Image.hpp"
 #include "src/viewer/image/NatureElementImage.hpp"
 
 const QBrush ImageLibrary::GREEN_BRUSH = QBrush(QColor(0, 224, 0, 127), Qt::SolidPattern);
 const QBrush ImageLibrary::ORANGE_BRUSH = QBrush(QColor(255, 154, 36, 127), Qt::SolidPattern);
 const QBrush ImageLibrary::RED_BRUSH = QBrush(QColor(244, 0, 0, 127), Qt::SolidPattern);
 
+const int CONSTRUCTION_IMAGES_MAX_COST(2048 * 2048);///< In pixels.
+const int MIPMAPS_CACHE_LIMIT(64 * 1024);///< In kilobytes, shared by the mipmaps of all the images.
+
+
+
+/**
+ * @brief A construction image, with a small atlas of its own so that it can be dropped alone.
+ */
+struct ImageLibrary::ConstructionImage
+{
+    ImageAtlas atlas;
+    Image image;
+
+    ConstructionImage(QThreadPool& decodingPool, const Image& sourceImage, const QBrush& brush) :
+        atlas(decodingPool, QString(), 0),
+        image(atlas, sourceImage, brush)
+    {
+        atlas.finalize();
+    }
+};
+
 
 
 ImageLibrary::ImageLibrary(const Conf& conf) :
+    decodingPool(),
+    buildingAtlas(decodingPool, "buildings"),
+    characterAtlas(decodingPool, "characters"),
+    natureElementAtlas(decodingPool, "natureElements"),
     buildingImages(),
     characterImages(),
-    natureElementImages()
+    natureElementImages(),
+    constructionImages(CONSTRUCTION_IMAGES_MAX_COST)
 {
+    QPixmapCache::setCacheLimit(MIPMAPS_CACHE_LIMIT);
+
     // Load building images.
     for (auto buildingKey : conf.getAllBuildingKeys()) {
         auto& buildingConf(conf.getBuildingConf(buildingKey));
-        buildingImages.insert(&buildingConf, new BuildingImage(buildingConf, GREEN_BRUSH));
+        buildingImages.insert(&buildingConf, new BuildingImage(buildingAtlas, buildingConf));
     }
 
     // Load character images.
     for (auto characterKey : conf.getAllCharacterKeys()) {
         auto& characterConf(conf.getCharacterConf(characterKey));
-        characterImages.insert(&characterConf, new CharacterImage(characterConf.getGraphicsData()));
+        characterImages.insert(&characterConf, new CharacterImage(characterAtlas, characterConf.getGraphicsData()));
     }
 
     // Load nature element images.
     for (auto natureElementKey : conf.getAllNatureElementKeys()) {
         auto& natureElementConf(conf.getNatureElementConf(natureElementKey));
-        natureElementImages.insert(&natureElementConf, new NatureElementImage(natureElementConf.getImagePath()));
+        natureElementImages.insert(
+            &natureElementConf,
+            new NatureElementImage(natureElementAtlas, natureElementConf.getImagePath())
+        );
     }
+
+    // Wait for the main images, decoded in parallel while the images were created. A main image that cannot be decoded
+    // fails the creation of the library.
+    buildingAtlas.waitForImages();
+    characterAtlas.waitForImages();
+    natureElementAtlas.waitForImages();
+
+    buildingAtlas.finalize();
+    characterAtlas.finalize();
+    natureElementAtlas.finalize();
 }
 
 
 
 ImageLibrary::~ImageLibrary()
 {
+    // The decoding tasks still running refer to the atlases.
+    decodingPool.waitForDone();
     qDeleteAll(buildingImages);
     qDeleteAll(characterImages);
     qDeleteAll(natureElementImages);
@@ -50,6 +96,17 @@ ImageLibrary::~ImageLibrary()
 
 
 
+bool ImageLibrary::update()
+{
+    auto hasNewImages(buildingAtlas.update());
+    hasNewImages = characterAtlas.update() || hasNewImages;
+    hasNewImages = natureElementAtlas.update() || hasNewImages;
+
+    return hasNewImages;
+}
+
+
+
 const BuildingImage& ImageLibrary::getBuildingImage(const BuildingInformation& buildingConf) const
 {
     if (!buildingImages.contains(&buildingConf)) {
@@ -61,6 +118,25 @@ const BuildingImage& ImageLibrary::getBuildingImage(const BuildingInformation& b
 
 
 
+const Image& ImageLibrary::getConstructionImage(const Image& sourceImage) const
+{
+    auto constructionImage(constructionImages.object(&sourceImage));
+    if (!constructionImage) {
+        constructionImage = new ConstructionImage(decodingPool, sourceImage, GREEN_BRUSH);
+        auto size(constructionImage->image.getSize());
+        // An image costing more than the whole cache would be deleted right away.
+        constructionImages.insert(
+            &sourceImage,
+            constructionImage,
+            qMin(size.width() * size.height(), CONSTRUCTION_IMAGES_MAX_COST)
+        );
+    }
+
+    return constructionImage->image;
+}
+
+
+
 const CharacterImage& ImageLibrary::getCharacterImage(const CharacterInformation& characterConf) const
 {
     if (!characterImages.contains(&characterConf)) {
@@ -1,19 +1,31 @@
 #ifndef IMAGELIBRARY_HPP
 #define IMAGELIBRARY_HPP
 
+#include <QtCore/QCache>
 #include <QtCore/QHash>
+#include <QtCore/QThreadPool>
 #include <QtGui/QBrush>
 
+#include "src/viewer/image/ImageAtlas.hpp"
+
 class BuildingImage;
 class BuildingInformation;
 class CharacterImage;
 class CharacterInformation;
 class Conf;
+class Image;
 class NatureElementImage;
 class NatureElementInformation;
 
 /**
  * @brief A library that load all the images needed to display anything on the map.
+ *
+ * The images are packed into one atlas per category of elements, cached on disk between two runs. The construction
+ * images, only displayed while placing a new building, are tinted on first use and kept in a bounded cache.
+ *
+ * The image files are decoded in parallel on a thread pool. The library waits for the main images of the elements when
+ * it is created, while the animations are only loaded when they are requested: the library must then be updated
+ * regularly to pack the newly decoded images into the atlases.
  */
 class ImageLibrary
 {
@@ -25,17 +37,42 @@ class ImageLibrary
         static const QBrush RED_BRUSH;
 
     private:
+        struct ConstructionImage;
+
+    private:
+        mutable QThreadPool decodingPool;
+        ImageAtlas buildingAtlas;
+        ImageAtlas characterAtlas;
+        ImageAtlas natureElementAtlas;
         QHash<const BuildingInformation*, const BuildingImage*> buildingImages;
         QHash<const CharacterInformation*, const CharacterImage*> characterImages;
         QHash<const NatureElementInformation*, const NatureElementImage*> natureElementImages;
+        mutable QCache<const Image*, ConstructionImage> constructionImages;///< The construction images, by source image.
 
     public:
         ImageLibrary(const Conf& conf);
 
         ~ImageLibrary();
 
+        /**
+         * @brief Pack the images decoded since the last update into the atlases.
+         *
+         * Never throws: an animation that cannot be decoded is reported as a warning and keeps its placeholder.
+         *
+         * @return Whether some images became ready.
+         */
+        bool update();
+
         const BuildingImage& getBuildingImage(const BuildingInformation& buildingConf) const;
 
+        /**
+         * @brief Get the construction image of a main image, tinted on first use.
+         *
+         * The least recently used construction images are dropped once the cache is full: the returned image must not be
+         * kept longer than the construction cursor that displays it.
+         */
+        const Image& getConstructionImage(const Image& sourceImage) const;
+
         const CharacterImage& getCharacterImage(const CharacterInformation& characterConf) const;
 
         const NatureElementImage& getNatureElementImage(const NatureElementInformation& natureElementConf) const;
@@ -4,11 +4,24 @@
 
 
 
-ImageSequence::ImageSequence(const QList<const ImageSequenceInformation*>& imagesSequenceInformations) :
-    images()
+ImageSequence::ImageSequence() :
+    images(),
+    isLoaded(false)
+{
+
+}
+
+
+
+ImageSequence::ImageSequence(
+    ImageAtlas& atlas,
+    const QList<const ImageSequenceInformation*>& imagesSequenceInformations
+) :
+    images(),
+    isLoaded(false)
 {
     for (auto imageSequenceInformation : imagesSequenceInformations) {
-        images.append(new Image(imageSequenceInformation->path, imageSequenceInformation->position));
+        images.append(new Image(atlas, imageSequenceInformation->path, imageSequenceInformation->position, false));
     }
 }
 
@@ -30,5 +43,12 @@ int ImageSequence::getSequenceLength() const
 
 const Image& ImageSequence::getImage(int sequenceIndex) const
 {
+    if (!isLoaded) {
+        for (auto image : images) {
+            image->load();
+        }
+        isLoaded = true;
+    }
+
     return *images.at(sequenceIndex % images.length());
 }
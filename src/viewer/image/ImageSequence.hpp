@@ -8,8 +8,13 @@
 #include "src/global/conf/ImageSequenceInformation.hpp"
 #include "src/viewer/image/Image.hpp"
 
+class ImageAtlas;
+
 /**
  * @brief A sequence of images that creates an animation.
+ *
+ * The images of a sequence are only loaded the first time one of them is requested, so that the animations that are
+ * never displayed during a run are never decoded.
  */
 class ImageSequence
 {
@@ -17,15 +22,27 @@ class ImageSequence
 
     private:
         QList<const Image*> images;
+        mutable bool isLoaded;
 
     public:
         /**
-         * @brief Load all the images of a sequence.
+         * @brief Create an empty sequence.
+         */
+        ImageSequence();
+
+        /**
+         * @brief Create all the images of a sequence in the atlas, without loading them.
          */
-        ImageSequence(const QList<const ImageSequenceInformation*>& imagesSequenceInformations);
+        ImageSequence(ImageAtlas& atlas, const QList<const ImageSequenceInformation*>& imagesSequenceInformations);
         ~ImageSequence();
 
         int getSequenceLength() const;
+
+        /**
+         * @brief Get an image of the sequence, loading the whole sequence on the first call.
+         *
+         * The image may not be ready yet.
+         */
         const Image& getImage(int sequenceIndex) const;
 };
 
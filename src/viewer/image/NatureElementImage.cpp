@@ -2,8 +2,8 @@
 
 
 
-NatureElementImage::NatureElementImage(const QString& imagePath) :
-    image(imagePath, {})
+NatureElementImage::NatureElementImage(ImageAtlas& atlas, const QString& imagePath) :
+    image(atlas, imagePath, {})
 {
 
 }
@@ -6,6 +6,8 @@
 
 #include "src/viewer/image/Image.hpp"
 
+class ImageAtlas;
+
 /**
  * @brief Handles all the images required to display a nature element.
  */
@@ -17,7 +19,7 @@ class NatureElementImage
         const Image image;
 
     public:
-        NatureElementImage(const QString& imagePath);
+        NatureElementImage(ImageAtlas& atlas, const QString& imagePath);
 
         const Image& getImage() const;
 };
@@ -0,0 +1,59 @@
+#ifndef CITYSNAPSHOTCOMPARISON_HPP
+#define CITYSNAPSHOTCOMPARISON_HPP
+
+#include <cstring>
+#include <QtTest>
+
+#include "src/engine/loader/CitySnapshot.hpp"
+
+/**
+ * @brief Compare records written as raw memory, padding included (see CitySnapshot).
+ */
+template<typename Record>
+static void compareRecords(const QVector<Record>& actual, const QVector<Record>& expected)
+{
+    QCOMPARE(actual.size(), expected.size());
+    for (int i(0); i < actual.size(); ++i) {
+        QVERIFY2(
+            std::memcmp(&actual.at(i), &expected.at(i), sizeof(Record)) == 0,
+            qPrintable(QString("Record %1 differs").arg(i))
+        );
+    }
+}
+
+
+
+/**
+ * @brief Compare all the fields of two snapshots, the records being compared as raw memory.
+ */
+static void compare(const CitySnapshot& actual, const CitySnapshot& expected)
+{
+    QCOMPARE(actual.title, expected.title);
+    QCOMPARE(actual.year, expected.year);
+    QCOMPARE(actual.month, expected.month);
+    QCOMPARE(actual.cycles, expected.cycles);
+    QCOMPARE(actual.budget, expected.budget);
+    QCOMPARE(actual.population, expected.population);
+    QCOMPARE(actual.workerFrontier, expected.workerFrontier);
+    QCOMPARE(actual.workers, expected.workers);
+    QCOMPARE(actual.mapSize, expected.mapSize);
+    QCOMPARE(actual.mapEntryPoint.x, expected.mapEntryPoint.x);
+    QCOMPARE(actual.mapEntryPoint.y, expected.mapEntryPoint.y);
+    QCOMPARE(actual.randomGeneratorState, expected.randomGeneratorState);
+    QCOMPARE(actual.buildingKeys, expected.buildingKeys);
+    QCOMPARE(actual.characterKeys, expected.characterKeys);
+    QCOMPARE(actual.itemKeys, expected.itemKeys);
+    QCOMPARE(actual.natureElementKeys, expected.natureElementKeys);
+    compareRecords(actual.natureElements, expected.natureElements);
+    QVERIFY(
+        std::memcmp(&actual.civilianEntryPoint, &expected.civilianEntryPoint, sizeof(CitySnapshot::Building)) == 0
+    );
+    compareRecords(actual.buildings, expected.buildings);
+    QCOMPARE(actual.characterSlots, expected.characterSlots);
+    QCOMPARE(actual.releasedCharacterSlots, expected.releasedCharacterSlots);
+    compareRecords(actual.characters, expected.characters);
+    compareRecords(actual.pathTiles, expected.pathTiles);
+    QCOMPARE(actual.values, expected.values);
+}
+
+#endif // CITYSNAPSHOTCOMPARISON_HPP
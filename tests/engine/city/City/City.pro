@@ -0,0 +1,13 @@
+QT += core testlib
+QT -= gui
+
+TARGET = CityTest
+CONFIG += c++14 qt console warn_on depend_includepath testcase
+CONFIG -= app_bundle
+
+TEMPLATE = app
+
+include(../../engine.pri)
+
+SOURCES += \
+    CityTest.cpp
@@ -0,0 +1,132 @@
+#include <QtTest>
+
+#include "src/engine/city/City.hpp"
+#include "src/engine/loader/CityLoader.hpp"
+#include "src/engine/loader/CitySnapshot.hpp"
+#include "src/global/conf/Conf.hpp"
+#include "src/global/state/BuildingState.hpp"
+#include "src/global/state/CharacterState.hpp"
+#include "tests/engine/CitySnapshotComparison.hpp"
+
+/**
+ * @brief Compare the states sent to the viewer, except their versions which start over on restoration.
+ */
+static void compareStates(const City& actual, const City& expected)
+{
+    auto actualCity(actual.getCurrentState());
+    auto expectedCity(expected.getCurrentState());
+    QCOMPARE(actualCity.budget, expectedCity.budget);
+    QCOMPARE(actualCity.population, expectedCity.population);
+    QCOMPARE(actualCity.date.year, expectedCity.date.year);
+    QCOMPARE(actualCity.date.month, expectedCity.date.month);
+
+    auto actualBuildings(actual.getBuildingsState());
+    auto expectedBuildings(expected.getBuildingsState());
+    QCOMPARE(actualBuildings.size(), expectedBuildings.size());
+    for (int i(0); i < actualBuildings.size(); ++i) {
+        auto& actualBuilding(actualBuildings.at(i));
+        auto& expectedBuilding(expectedBuildings.at(i));
+        QCOMPARE(actualBuilding.id, expectedBuilding.id);
+        QCOMPARE(&actualBuilding.getType(), &expectedBuilding.getType());
+        QCOMPARE(actualBuilding.area.leftCorner(), expectedBuilding.area.leftCorner());
+        QCOMPARE(actualBuilding.status, expectedBuilding.status);
+        QCOMPARE(actualBuilding.workers, expectedBuilding.workers);
+    }
+
+    auto actualCharacters(actual.getCharactersState());
+    auto expectedCharacters(expected.getCharactersState());
+    QCOMPARE(actualCharacters.size(), expectedCharacters.size());
+    for (int i(0); i < actualCharacters.size(); ++i) {
+        auto& actualCharacter(actualCharacters.at(i));
+        auto& expectedCharacter(expectedCharacters.at(i));
+        QCOMPARE(actualCharacter.id, expectedCharacter.id);
+        QCOMPARE(&actualCharacter.type, &expectedCharacter.type);
+        QCOMPARE(actualCharacter.position, expectedCharacter.position);
+        QCOMPARE(actualCharacter.direction, expectedCharacter.direction);
+        QCOMPARE(actualCharacter.status, expectedCharacter.status);
+    }
+}
+
+class CityTest : public QObject
+{
+        Q_OBJECT
+
+    private:
+        Conf conf;
+
+    public:
+        CityTest() :
+            conf(ASSETS_DIRECTORY "/zeus")
+        {
+
+        }
+
+    private slots:
+        void test_restored_city_evolves_like_original_data()
+        {
+            QTest::addColumn<int>("elapsedCycles");
+
+            QTest::newRow("Just started") << 1;
+            QTest::newRow("After immigration") << 300;
+            QTest::newRow("After a few months") << 3000;
+        }
+
+        void test_restored_city_evolves_like_original()
+        {
+            // Given
+            QFETCH(int, elapsedCycles);
+            const int COMPARED_CYCLES(300);
+            CityLoader loader(ASSETS_DIRECTORY "/zeus/maps/testing-with-houses.yaml");
+            City original(conf, loader);
+            // Some working places along the road, so that the snapshot holds workers and walkers.
+            original.createBuilding(conf.getBuildingConf("maintenance"), { -6, 14 }, Direction::West);
+            original.createBuilding(conf.getBuildingConf("gymnasium"), { -6, 18 }, Direction::West);
+            original.createBuilding(conf.getBuildingConf("fountain"), { -6, 22 }, Direction::West);
+            original.getProcessor().processCycles(elapsedCycles);
+
+            // When
+            CitySnapshot snapshot;
+            original.save(snapshot);
+            City restored(conf, snapshot);
+
+            // Then
+            CitySnapshot restoredSnapshot;
+            restored.save(restoredSnapshot);
+            compare(restoredSnapshot, snapshot);
+            if (QTest::currentTestFailed()) {
+                return;
+            }
+            compareStates(restored, original);
+            if (QTest::currentTestFailed()) {
+                return;
+            }
+
+            // The random generator is restored too: both cities take the same decisions from now on.
+            bool hasCharacters(!snapshot.characters.isEmpty());
+            for (int cycle(1); cycle <= COMPARED_CYCLES; ++cycle) {
+                original.getProcessor().processCycles(1);
+                restored.getProcessor().processCycles(1);
+
+                CitySnapshot expected;
+                CitySnapshot actual;
+                original.save(expected);
+                restored.save(actual);
+                compare(actual, expected);
+                if (QTest::currentTestFailed()) {
+                    qWarning() << "Cities diverge at cycle" << cycle << "after restoration.";
+                    return;
+                }
+                compareStates(restored, original);
+                if (QTest::currentTestFailed()) {
+                    qWarning() << "Cities diverge at cycle" << cycle << "after restoration.";
+                    return;
+                }
+                hasCharacters = hasCharacters || !expected.characters.isEmpty();
+            }
+            QVERIFY(hasCharacters);
+            QVERIFY(!snapshot.workers.isEmpty());
+        }
+};
+
+QTEST_MAIN(CityTest)
+#include "CityTest.moc"
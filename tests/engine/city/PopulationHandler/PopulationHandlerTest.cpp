@@ -0,0 +1,215 @@
+#include <algorithm>
+#include <QtTest>
+#include <QtCore/QList>
+#include <QtCore/QSharedPointer>
+
+#include "src/engine/city/PopulationHandler.hpp"
+#include "src/engine/map/staticElement/building/AbstractProcessableBuilding.hpp"
+#include "src/engine/map/Tile.hpp"
+#include "src/engine/processing/CycleDate.hpp"
+#include "src/global/conf/BuildingInformation.hpp"
+#include "src/global/conf/Conf.hpp"
+
+/**
+ * @brief A working place doing nothing but receiving its workers.
+ */
+class WorkingPlace : public AbstractProcessableBuilding
+{
+    public:
+        WorkingPlace(const BuildingInformation& conf, const Tile& entryPointTile) :
+            AbstractProcessableBuilding(conf, TileArea({ 0, 0 }, { 1 }), Direction::West, entryPointTile)
+        {
+
+        }
+
+        int getWorkers() const
+        {
+            return getCurrentWorkerQuantity();
+        }
+
+        virtual void process(const CycleDate& /*date*/) override
+        {
+
+        }
+};
+
+
+
+class PopulationHandlerTest : public QObject
+{
+        Q_OBJECT
+
+    private:
+        Conf conf;
+        Tile entryPointTile;
+        PopulationHandler handler;
+        QList<QSharedPointer<WorkingPlace>> registeredPlaces;///< In registration order.
+
+    public:
+        PopulationHandlerTest() :
+            conf(ASSETS_DIRECTORY "/zeus"),
+            entryPointTile(0, 0),
+            handler(),
+            registeredPlaces()
+        {
+
+        }
+
+    private:
+        void registerPlace(const QString& confKey)
+        {
+            registeredPlaces.append(QSharedPointer<WorkingPlace>::create(conf.getBuildingConf(confKey), entryPointTile));
+            handler.registerWorkingPlace(registeredPlaces.last());
+        }
+
+        void unregisterPlace(const int index)
+        {
+            handler.unregisterWorkingPlace(registeredPlaces.takeAt(index));
+        }
+
+        void setPopulation(const int population)
+        {
+            auto difference(population - handler.getCurrentPopulation());
+            if (difference > 0) {
+                handler.registerPopulation(difference);
+            }
+            else {
+                handler.unregisterPopulation(-difference);
+            }
+            handler.process(CycleDate());
+        }
+
+        /**
+         * @brief Check the workers of each place against a greedy fill of all the places from scratch.
+         *
+         * The places are filled by decreasing priority, then by registration order, with half of the population.
+         */
+        void verifyDistribution()
+        {
+            QList<QSharedPointer<WorkingPlace>> places(registeredPlaces);
+            std::stable_sort(places.begin(), places.end(), [](auto& place, auto& otherPlace) {
+                return place->getConf().getWorkerPriority() > otherPlace->getConf().getWorkerPriority();
+            });
+
+            int remainingWorkers(handler.getCurrentPopulation() / 2);
+            for (auto& place : places) {
+                int expectedWorkers(qMin(remainingWorkers, place->getConf().getMaxWorkers()));
+                remainingWorkers -= expectedWorkers;
+                QCOMPARE(place->getWorkers(), expectedWorkers);
+            }
+        }
+
+    private slots:
+        void init()
+        {
+            // Priority 0: armory (18 workers), college (12), podium (4). Priority 1: fountain (4), infirmary (11).
+            registerPlace("armory");
+            registerPlace("fountain");
+            registerPlace("college");
+            registerPlace("infirmary");
+            registerPlace("podium");
+        }
+
+        void cleanup()
+        {
+            while (!registeredPlaces.isEmpty()) {
+                unregisterPlace(0);
+            }
+            setPopulation(0);
+        }
+
+
+
+        void test_distribution_follows_population_growth_and_shrinkage()
+        {
+            for (int population : { 0, 1, 8, 30, 31, 52, 120, 200, 97, 64, 9, 0, 150 }) {
+                // When
+                setPopulation(population);
+
+                // Then
+                verifyDistribution();
+            }
+        }
+
+
+
+        void test_higher_priority_place_is_filled_first_data()
+        {
+            QTest::addColumn<int>("population");
+
+            QTest::newRow("Frontier among the priority places") << 20;
+            QTest::newRow("Frontier among the other places") << 50;
+            QTest::newRow("All places full") << 200;
+        }
+
+        void test_higher_priority_place_is_filled_first()
+        {
+            // Given
+            QFETCH(int, population);
+            setPopulation(population);
+
+            // When
+            registerPlace("maintenance");
+            handler.process(CycleDate());
+
+            // Then
+            verifyDistribution();
+        }
+
+
+
+        void test_lower_priority_place_is_filled_last()
+        {
+            // Given
+            setPopulation(50);
+
+            // When
+            registerPlace("gymnasium");
+            handler.process(CycleDate());
+            setPopulation(100);
+
+            // Then
+            verifyDistribution();
+        }
+
+
+
+        void test_unregistered_place_frees_its_workers_data()
+        {
+            QTest::addColumn<int>("population");
+            QTest::addColumn<int>("unregisteredPlace");
+
+            // With 80 people, the frontier is the college: the fountain, the infirmary and the armory are full, the podium
+            // is empty.
+            QTest::newRow("Before the frontier") << 80 << 0;
+            QTest::newRow("Priority place before the frontier") << 80 << 1;
+            QTest::newRow("At the frontier") << 80 << 2;
+            QTest::newRow("After the frontier") << 80 << 4;
+            QTest::newRow("Every place full") << 200 << 3;
+            QTest::newRow("No worker") << 0 << 0;
+        }
+
+        void test_unregistered_place_frees_its_workers()
+        {
+            // Given
+            QFETCH(int, population);
+            QFETCH(int, unregisteredPlace);
+            setPopulation(population);
+
+            // When
+            unregisterPlace(unregisteredPlace);
+            handler.process(CycleDate());
+
+            // Then
+            verifyDistribution();
+
+            // When
+            setPopulation(population / 3);
+
+            // Then
+            verifyDistribution();
+        }
+};
+
+QTEST_MAIN(PopulationHandlerTest)
+#include "PopulationHandlerTest.moc"
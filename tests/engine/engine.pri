@@ -0,0 +1,182 @@
+# The sources of the engine, without any graphical part, for the tests needing a whole city.
+
+INCLUDEPATH += $$PWD/../..
+
+# The configuration and the maps of the tests are the ones of the game.
+DEFINES += ASSETS_DIRECTORY=\\\"$$PWD/../../assets\\\"
+
+SOURCES += \
+    $$PWD/../../src/engine/Engine.cpp \
+    $$PWD/../../src/engine/StateJournal.cpp \
+    $$PWD/../../src/engine/city/City.cpp \
+    $$PWD/../../src/engine/city/PopulationHandler.cpp \
+    $$PWD/../../src/engine/loader/CityLoader.cpp \
+    $$PWD/../../src/engine/loader/CitySnapshot.cpp \
+    $$PWD/../../src/engine/map/dynamicElement/character/Character.cpp \
+    $$PWD/../../src/engine/map/dynamicElement/character/DeliveryManCharacter.cpp \
+    $$PWD/../../src/engine/map/dynamicElement/character/ImmigrantCharacter.cpp \
+    $$PWD/../../src/engine/map/dynamicElement/character/MinerCharacter.cpp \
+    $$PWD/../../src/engine/map/dynamicElement/character/StudentCharacter.cpp \
+    $$PWD/../../src/engine/map/dynamicElement/character/WanderingCharacter.cpp \
+    $$PWD/../../src/engine/map/dynamicElement/DynamicElementFactory.cpp \
+    $$PWD/../../src/engine/map/dynamicElement/DynamicElementRegistry.cpp \
+    $$PWD/../../src/engine/map/dynamicElement/MotionHandler.cpp \
+    $$PWD/../../src/engine/map/dynamicElement/MotionKernel.cpp \
+    $$PWD/../../src/engine/map/dynamicElement/MotionStore.cpp \
+    $$PWD/../../src/engine/map/path/algorithm/PathFinder.cpp \
+    $$PWD/../../src/engine/map/path/algorithm/RegisteredTileBag.cpp \
+    $$PWD/../../src/engine/map/path/PathGenerator.cpp \
+    $$PWD/../../src/engine/map/path/RandomRoadPath.cpp \
+    $$PWD/../../src/engine/map/path/TargetedPath.cpp \
+    $$PWD/../../src/engine/map/staticElement/building/behavior/WalkerGenerationBehavior.cpp \
+    $$PWD/../../src/engine/map/staticElement/building/AbstractBuilding.cpp \
+    $$PWD/../../src/engine/map/staticElement/building/AbstractProcessableBuilding.cpp \
+    $$PWD/../../src/engine/map/staticElement/building/AbstractStoringBuilding.cpp \
+    $$PWD/../../src/engine/map/staticElement/building/BuildingSearchEngine.cpp \
+    $$PWD/../../src/engine/map/staticElement/building/CivilianEntryPoint.cpp \
+    $$PWD/../../src/engine/map/staticElement/building/FarmBuilding.cpp \
+    $$PWD/../../src/engine/map/staticElement/building/HouseBuilding.cpp \
+    $$PWD/../../src/engine/map/staticElement/building/IndustrialBuilding.cpp \
+    $$PWD/../../src/engine/map/staticElement/building/LaboratoryBuilding.cpp \
+    $$PWD/../../src/engine/map/staticElement/building/ProducerBuilding.cpp \
+    $$PWD/../../src/engine/map/staticElement/building/Road.cpp \
+    $$PWD/../../src/engine/map/staticElement/building/SanityBuilding.cpp \
+    $$PWD/../../src/engine/map/staticElement/building/SchoolBuilding.cpp \
+    $$PWD/../../src/engine/map/staticElement/building/StorageBuilding.cpp \
+    $$PWD/../../src/engine/map/staticElement/natureElement/NatureElement.cpp \
+    $$PWD/../../src/engine/map/staticElement/natureElement/NatureElementSearchEngine.cpp \
+    $$PWD/../../src/engine/map/staticElement/StaticElementFactory.cpp \
+    $$PWD/../../src/engine/map/staticElement/StaticElementRegistry.cpp \
+    $$PWD/../../src/engine/map/Map.cpp \
+    $$PWD/../../src/engine/map/Tile.cpp \
+    $$PWD/../../src/engine/processing/AbstractProcessable.cpp \
+    $$PWD/../../src/engine/processing/CycleDate.cpp \
+    $$PWD/../../src/engine/processing/TimeCycleProcessor.cpp \
+    $$PWD/../../src/engine/simulation/CitySimulation.cpp \
+    $$PWD/../../src/engine/simulation/SimulationHost.cpp \
+    $$PWD/../../src/exceptions/BadConfigurationException.cpp \
+    $$PWD/../../src/exceptions/EngineException.cpp \
+    $$PWD/../../src/exceptions/Exception.cpp \
+    $$PWD/../../src/exceptions/FileNotFoundException.cpp \
+    $$PWD/../../src/exceptions/NotImplementedException.cpp \
+    $$PWD/../../src/exceptions/OutOfRangeException.cpp \
+    $$PWD/../../src/exceptions/UnexpectedException.cpp \
+    $$PWD/../../src/global/conf/BuildingAreaInformation.cpp \
+    $$PWD/../../src/global/conf/BuildingInformation.cpp \
+    $$PWD/../../src/global/conf/CharacterInformation.cpp \
+    $$PWD/../../src/global/conf/Conf.cpp \
+    $$PWD/../../src/global/conf/ControlPanelElementInformation.cpp \
+    $$PWD/../../src/global/conf/ImageSequenceInformation.cpp \
+    $$PWD/../../src/global/conf/ItemInformation.cpp \
+    $$PWD/../../src/global/conf/ModelReader.cpp \
+    $$PWD/../../src/global/conf/NatureElementInformation.cpp \
+    $$PWD/../../src/global/geometry/DynamicElementCoordinates.cpp \
+    $$PWD/../../src/global/geometry/TileArea.cpp \
+    $$PWD/../../src/global/geometry/TileAreaSize.cpp \
+    $$PWD/../../src/global/geometry/TileCoordinates.cpp \
+    $$PWD/../../src/global/BuildingStatus.cpp \
+    $$PWD/../../src/global/CharacterStatus.cpp \
+    $$PWD/../../src/global/Direction.cpp
+
+HEADERS += \
+    $$PWD/../../src/engine/Engine.hpp \
+    $$PWD/../../src/engine/StateJournal.hpp \
+    $$PWD/../../src/engine/city/City.hpp \
+    $$PWD/../../src/engine/city/PopulationHandler.hpp \
+    $$PWD/../../src/engine/city/PopulationRegistryInterface.hpp \
+    $$PWD/../../src/engine/city/WorkingPlaceRegistryInterface.hpp \
+    $$PWD/../../src/engine/loader/CityLoader.hpp \
+    $$PWD/../../src/engine/loader/CitySnapshot.hpp \
+    $$PWD/../../src/engine/map/dynamicElement/character/Character.hpp \
+    $$PWD/../../src/engine/map/dynamicElement/character/DeliveryManCharacter.hpp \
+    $$PWD/../../src/engine/map/dynamicElement/character/ImmigrantCharacter.hpp \
+    $$PWD/../../src/engine/map/dynamicElement/character/MinerCharacter.hpp \
+    $$PWD/../../src/engine/map/dynamicElement/character/StudentCharacter.hpp \
+    $$PWD/../../src/engine/map/dynamicElement/character/WanderingCharacter.hpp \
+    $$PWD/../../src/engine/map/dynamicElement/CharacterDisposerInterface.hpp \
+    $$PWD/../../src/engine/map/dynamicElement/CharacterGeneratorInterface.hpp \
+    $$PWD/../../src/engine/map/dynamicElement/DynamicElementFactory.hpp \
+    $$PWD/../../src/engine/map/dynamicElement/DynamicElementRegistry.hpp \
+    $$PWD/../../src/engine/map/dynamicElement/MotionHandler.hpp \
+    $$PWD/../../src/engine/map/dynamicElement/MotionKernel.hpp \
+    $$PWD/../../src/engine/map/dynamicElement/MotionStore.hpp \
+    $$PWD/../../src/engine/map/path/algorithm/PathFinder.hpp \
+    $$PWD/../../src/engine/map/path/algorithm/RegisteredTileBag.hpp \
+    $$PWD/../../src/engine/map/path/PathGenerator.hpp \
+    $$PWD/../../src/engine/map/path/PathGeneratorInterface.hpp \
+    $$PWD/../../src/engine/map/path/PathInterface.hpp \
+    $$PWD/../../src/engine/map/path/RandomRoadPath.hpp \
+    $$PWD/../../src/engine/map/path/TargetedPath.hpp \
+    $$PWD/../../src/engine/map/staticElement/building/behavior/WalkerGenerationBehavior.hpp \
+    $$PWD/../../src/engine/map/staticElement/building/AbstractBuilding.hpp \
+    $$PWD/../../src/engine/map/staticElement/building/AbstractProcessableBuilding.hpp \
+    $$PWD/../../src/engine/map/staticElement/building/AbstractStoringBuilding.hpp \
+    $$PWD/../../src/engine/map/staticElement/building/BuildingResolverInterface.hpp \
+    $$PWD/../../src/engine/map/staticElement/building/BuildingSearchEngine.hpp \
+    $$PWD/../../src/engine/map/staticElement/building/CivilianEntryPoint.hpp \
+    $$PWD/../../src/engine/map/staticElement/building/FarmBuilding.hpp \
+    $$PWD/../../src/engine/map/staticElement/building/HouseBuilding.hpp \
+    $$PWD/../../src/engine/map/staticElement/building/ImmigrantGeneratorInterface.hpp \
+    $$PWD/../../src/engine/map/staticElement/building/IndustrialBuilding.hpp \
+    $$PWD/../../src/engine/map/staticElement/building/LaboratoryBuilding.hpp \
+    $$PWD/../../src/engine/map/staticElement/building/ProducerBuilding.hpp \
+    $$PWD/../../src/engine/map/staticElement/building/Road.hpp \
+    $$PWD/../../src/engine/map/staticElement/building/SanityBuilding.hpp \
+    $$PWD/../../src/engine/map/staticElement/building/SchoolBuilding.hpp \
+    $$PWD/../../src/engine/map/staticElement/building/StorageBuilding.hpp \
+    $$PWD/../../src/engine/map/staticElement/natureElement/NatureElement.hpp \
+    $$PWD/../../src/engine/map/staticElement/natureElement/NatureElementSearchEngine.hpp \
+    $$PWD/../../src/engine/map/staticElement/AbstractStaticElement.hpp \
+    $$PWD/../../src/engine/map/staticElement/StaticElementFactory.hpp \
+    $$PWD/../../src/engine/map/staticElement/StaticElementRegistry.hpp \
+    $$PWD/../../src/engine/map/Map.hpp \
+    $$PWD/../../src/engine/map/Tile.hpp \
+    $$PWD/../../src/engine/processing/AbstractProcessable.hpp \
+    $$PWD/../../src/engine/processing/CycleDate.hpp \
+    $$PWD/../../src/engine/processing/TimeCycleProcessor.hpp \
+    $$PWD/../../src/engine/simulation/CitySimulation.hpp \
+    $$PWD/../../src/engine/simulation/SimulationHost.hpp \
+    $$PWD/../../src/exceptions/BadConfigurationException.hpp \
+    $$PWD/../../src/exceptions/EngineException.hpp \
+    $$PWD/../../src/exceptions/Exception.hpp \
+    $$PWD/../../src/exceptions/FileNotFoundException.hpp \
+    $$PWD/../../src/exceptions/NotImplementedException.hpp \
+    $$PWD/../../src/exceptions/OutOfRangeException.hpp \
+    $$PWD/../../src/exceptions/UnexpectedException.hpp \
+    $$PWD/../../src/global/concurrency/SpscQueue.hpp \
+    $$PWD/../../src/global/concurrency/TripleBuffer.hpp \
+    $$PWD/../../src/global/conf/BuildingAreaInformation.hpp \
+    $$PWD/../../src/global/conf/BuildingInformation.hpp \
+    $$PWD/../../src/global/conf/CharacterInformation.hpp \
+    $$PWD/../../src/global/conf/Conf.hpp \
+    $$PWD/../../src/global/conf/ControlPanelElementInformation.hpp \
+    $$PWD/../../src/global/conf/ImageSequenceInformation.hpp \
+    $$PWD/../../src/global/conf/ItemInformation.hpp \
+    $$PWD/../../src/global/conf/ModelReader.hpp \
+    $$PWD/../../src/global/conf/NatureElementInformation.hpp \
+    $$PWD/../../src/global/geometry/DynamicElementCoordinates.hpp \
+    $$PWD/../../src/global/geometry/GraphicalCoordinates.hpp \
+    $$PWD/../../src/global/geometry/TileArea.hpp \
+    $$PWD/../../src/global/geometry/TileAreaSize.hpp \
+    $$PWD/../../src/global/geometry/TileCoordinates.hpp \
+    $$PWD/../../src/global/pointer/Handle.hpp \
+    $$PWD/../../src/global/pointer/ObjectPool.hpp \
+    $$PWD/../../src/global/state/BuildingState.hpp \
+    $$PWD/../../src/global/state/CharacterState.hpp \
+    $$PWD/../../src/global/state/CityState.hpp \
+    $$PWD/../../src/global/state/MapState.hpp \
+    $$PWD/../../src/global/state/NatureElementState.hpp \
+    $$PWD/../../src/global/state/State.hpp \
+    $$PWD/../../src/global/state/StateDelta.hpp \
+    $$PWD/../../src/global/BuildingStatus.hpp \
+    $$PWD/../../src/global/CharacterStatus.hpp \
+    $$PWD/../../src/global/Direction.hpp \
+    $$PWD/../../src/global/yamlLibraryEnhancement.hpp \
+    $$PWD/../../src/defines.hpp
+
+unix: CONFIG += link_pkgconfig
+unix: PKGCONFIG += yaml-cpp
+
+win32: INCLUDEPATH += $$PWD/../../vendor/include
+win32: DEPENDPATH += $$PWD/../../vendor/include
+win32: LIBS += -L$$PWD/../../vendor/yaml-cpp/ -lyaml-cpp
@@ -2,4 +2,6 @@
 TEMPLATE = subdirs
 
 SUBDIRS = \
+    city \
+    loader \
     map
@@ -0,0 +1,18 @@
+QT += core testlib
+QT -= gui
+
+TARGET = CitySnapshotTest
+CONFIG += c++14 qt console warn_on depend_includepath testcase
+CONFIG -= app_bundle
+
+TEMPLATE = app
+
+INCLUDEPATH += ../../../..
+
+SOURCES += \
+    ../../../../src/engine/loader/CitySnapshot.cpp \
+    ../../../../src/exceptions/EngineException.cpp \
+    ../../../../src/exceptions/Exception.cpp \
+    ../../../../src/exceptions/FileNotFoundException.cpp \
+    ../../../../src/exceptions/UnexpectedException.cpp \
+    CitySnapshotTest.cpp
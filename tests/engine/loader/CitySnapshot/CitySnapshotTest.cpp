@@ -0,0 +1,225 @@
+#include <QtTest>
+#include <QtCore/QFile>
+#include <QtCore/QTemporaryDir>
+
+#include "src/engine/loader/CitySnapshot.hpp"
+#include "src/exceptions/FileNotFoundException.hpp"
+#include "src/exceptions/UnexpectedException.hpp"
+#include "tests/engine/CitySnapshotComparison.hpp"
+
+/**
+ * @brief Create a snapshot with the given quantity of buildings and characters, each one having a path and a value.
+ */
+static CitySnapshot createSnapshot(const int elementCount)
+{
+    CitySnapshot snapshot;
+    snapshot.title = "Snapshot test";
+    snapshot.year = -3000;
+    snapshot.month = 4;
+    snapshot.cycles = 12;
+    snapshot.budget = 5000;
+    snapshot.population = 240;
+    snapshot.workerFrontier = 1;
+    snapshot.workers = { 12, 3 };
+    snapshot.mapSize = QSize(400, 800);
+    snapshot.mapEntryPoint = { 7, 50 };
+    snapshot.randomGeneratorState = "5489 1 2 3";
+    snapshot.buildingKeys = QStringList({ "house", "road" });
+    snapshot.characterKeys = QStringList({ "immigrant" });
+    snapshot.itemKeys = QStringList({ "wheat", "copper" });
+    snapshot.natureElementKeys = QStringList({ "tree" });
+    // Resizing zeroes the records, padding included, as the records written by the city.
+    snapshot.natureElements.resize(1);
+    auto& natureElement(snapshot.natureElements.first());
+    natureElement.leftCorner = { 3, 4 };
+    natureElement.width = 1;
+    natureElement.height = 1;
+    natureElement.flags = CitySnapshot::NatureElement::Busy;
+    snapshot.civilianEntryPoint.countDown = 7;
+
+    snapshot.buildings.resize(elementCount);
+    snapshot.characters.resize(elementCount);
+    for (int i(0); i < elementCount; ++i) {
+        auto& building(snapshot.buildings[i]);
+        building.conf = i % 2;
+        building.leftCorner = { i, i + 1 };
+        building.quantity = i;
+        building.firstValue = snapshot.values.size();
+        building.valueCount = 1;
+        snapshot.values.append(qint64(i) << 32);
+
+        auto& character(snapshot.characters[i]);
+        character.handle = quint64(1) << 32 | i;
+        character.x = i + 0.25;
+        character.y = i - 0.5;
+        character.path.type = 1;
+        character.path.firstTile = snapshot.pathTiles.size();
+        character.path.tileCount = 1;
+        snapshot.pathTiles.append({ i, -i });
+        snapshot.characterSlots.append(1);
+    }
+    // A slot released by a destroyed character.
+    snapshot.characterSlots.append(2);
+    snapshot.releasedCharacterSlots.append(elementCount);
+
+    return snapshot;
+}
+
+class CitySnapshotTest : public QObject
+{
+        Q_OBJECT
+
+    private:
+        QTemporaryDir directory;
+
+    private slots:
+        void test_snapshot_is_restored_identically_data()
+        {
+            QTest::addColumn<bool>("compress");
+
+            QTest::newRow("Compressed") << true;
+            QTest::newRow("Uncompressed") << false;
+        }
+
+        void test_snapshot_is_restored_identically()
+        {
+            // Given
+            QFETCH(bool, compress);
+            auto filePath(directory.filePath("identical.city"));
+            auto snapshot(createSnapshot(100));
+
+            // When
+            snapshot.save(filePath, compress);
+
+            // Then
+            QVERIFY(CitySnapshot::isSnapshot(filePath));
+            compare(CitySnapshot::load(filePath), snapshot);
+        }
+
+
+
+        void test_key_is_indexed_once()
+        {
+            // Given
+            QStringList keys({ "house" });
+
+            // When
+            auto roadIndex(CitySnapshot::indexKey(keys, "road"));
+            auto houseIndex(CitySnapshot::indexKey(keys, "house"));
+            auto roadIndexAgain(CitySnapshot::indexKey(keys, "road"));
+
+            // Then
+            QCOMPARE(roadIndex, 1);
+            QCOMPARE(houseIndex, 0);
+            QCOMPARE(roadIndexAgain, 1);
+            QCOMPARE(keys.size(), 2);
+        }
+
+
+
+        void test_city_file_is_not_a_snapshot()
+        {
+            // Given
+            auto filePath(directory.filePath("city.yaml"));
+            QFile file(filePath);
+            QVERIFY(file.open(QIODevice::WriteOnly));
+            file.write("title: \"Not a snapshot\"\n");
+            file.close();
+
+            // When / Then
+            QVERIFY(!CitySnapshot::isSnapshot(filePath));
+            QVERIFY_EXCEPTION_THROWN(CitySnapshot::load(filePath), UnexpectedException);
+        }
+
+
+
+        void test_missing_file_is_not_found()
+        {
+            // Given
+            auto filePath(directory.filePath("missing.city"));
+
+            // When / Then
+            QVERIFY(!CitySnapshot::isSnapshot(filePath));
+            QVERIFY_EXCEPTION_THROWN(CitySnapshot::load(filePath), FileNotFoundException);
+        }
+
+
+
+        void test_other_version_is_rejected()
+        {
+            // Given
+            auto filePath(directory.filePath("version.city"));
+            createSnapshot(10).save(filePath);
+            QFile file(filePath);
+            QVERIFY(file.open(QIODevice::ReadWrite));
+            // The version follows the magic number, in big endian.
+            QVERIFY(file.seek(7));
+            file.write("\x02", 1);
+            file.close();
+
+            // When / Then
+            QVERIFY(CitySnapshot::isSnapshot(filePath));
+            QVERIFY_EXCEPTION_THROWN(CitySnapshot::load(filePath), UnexpectedException);
+        }
+
+
+
+        void test_truncated_snapshot_is_rejected_data()
+        {
+            QTest::addColumn<bool>("compress");
+
+            QTest::newRow("Compressed") << true;
+            QTest::newRow("Uncompressed") << false;
+        }
+
+        void test_truncated_snapshot_is_rejected()
+        {
+            // Given
+            QFETCH(bool, compress);
+            auto filePath(directory.filePath("truncated.city"));
+            createSnapshot(100).save(filePath, compress);
+            QFile file(filePath);
+            QVERIFY(file.resize(file.size() - 16));
+
+            // When / Then
+            QVERIFY_EXCEPTION_THROWN(CitySnapshot::load(filePath), UnexpectedException);
+        }
+
+
+
+        void test_inconsistent_snapshot_is_rejected()
+        {
+            // Given
+            auto filePath(directory.filePath("inconsistent.city"));
+            auto snapshot(createSnapshot(10));
+            snapshot.characters.last().path.tileCount = 2;
+            snapshot.save(filePath);
+
+            // When / Then
+            QVERIFY_EXCEPTION_THROWN(CitySnapshot::load(filePath), UnexpectedException);
+        }
+
+
+
+        void benchmark_load_data()
+        {
+            QTest::addColumn<bool>("compress");
+
+            QTest::newRow("100000 elements, compressed") << true;
+            QTest::newRow("100000 elements, uncompressed") << false;
+        }
+
+        void benchmark_load()
+        {
+            QFETCH(bool, compress);
+            auto filePath(directory.filePath("benchmark.city"));
+            createSnapshot(100000).save(filePath, compress);
+
+            QBENCHMARK {
+                CitySnapshot::load(filePath);
+            }
+        }
+};
+
+QTEST_MAIN(CitySnapshotTest)
+#include "CitySnapshotTest.moc"
@@ -0,0 +1,259 @@
+#include <QtTest>
+#include <QtCore/QSharedPointer>
+
+#include "src/engine/map/dynamicElement/MotionHandler.hpp"
+#include "src/engine/map/dynamicElement/MotionStore.hpp"
+#include "src/engine/map/path/PathInterface.hpp"
+#include "src/engine/map/Tile.hpp"
+
+const int GRID_SIZE(12);
+
+/**
+ * @brief A path through a fixed list of tiles.
+ */
+class TilePath : public PathInterface
+{
+    private:
+        QList<const Tile*> tiles;
+        int nextIndex;
+
+    public:
+        TilePath(const QList<const Tile*>& tiles) :
+            tiles(tiles),
+            nextIndex(0)
+        {
+
+        }
+
+        virtual Type getType() const override
+        {
+            return Type::RandomRoad;
+        }
+
+        virtual bool isObsolete() const override
+        {
+            return false;
+        }
+
+        virtual bool isCompleted() const override
+        {
+            return nextIndex >= tiles.size();
+        }
+
+        virtual bool isNextTileValid() const override
+        {
+            return nextIndex < tiles.size();
+        }
+
+        virtual const Tile& getNextTile() override
+        {
+            return *tiles.at(nextIndex++);
+        }
+
+        virtual void save(CitySnapshot& /*snapshot*/, CitySnapshot::Path& record) const override
+        {
+            record.type = CitySnapshot::NO_PATH;
+        }
+};
+
+/**
+ * @brief The motion of a character as it was processed before the motion store: the path is followed and the character
+ * moved one by one, during the processing of each character.
+ */
+class ReferenceMotion
+{
+    private:
+        const qreal speed;
+        QSharedPointer<PathInterface> path;
+        DynamicElementCoordinates location;
+        const Tile* movingFrom;
+        const Tile* movingTo;
+
+    public:
+        ReferenceMotion(const qreal speed, const Tile& initialTile) :
+            speed(speed),
+            path(),
+            location(initialTile.coordinates().toDynamicElementCoordinates()),
+            movingFrom(&initialTile),
+            movingTo(nullptr)
+        {
+
+        }
+
+        const DynamicElementCoordinates& getCurrentLocation() const
+        {
+            return location;
+        }
+
+        const Tile& getCurrentTile() const
+        {
+            return movingTo ? *movingTo : *movingFrom;
+        }
+
+        bool isPathCompleted() const
+        {
+            return !path.isNull() && path->isCompleted() && (
+                !movingTo || location == movingTo->coordinates().toDynamicElementCoordinates()
+            );
+        }
+
+        void takePath(QSharedPointer<PathInterface> path)
+        {
+            this->path = path;
+            movingTo = nullptr;
+            if (!path.isNull() && path->isNextTileValid()) {
+                movingTo = &path->getNextTile();
+                if (movingTo == movingFrom && path->isNextTileValid()) {
+                    movingTo = &path->getNextTile();
+                }
+            }
+        }
+
+        void move()
+        {
+            if (path.isNull() || !movingTo) {
+                return;
+            }
+
+            if (location == movingTo->coordinates().toDynamicElementCoordinates()) {
+                movingFrom = movingTo;
+                movingTo = nullptr;
+                if (path->isNextTileValid()) {
+                    movingTo = &path->getNextTile();
+                }
+            }
+            if (!movingTo) {
+                return;
+            }
+
+            auto& target(movingTo->coordinates());
+            if (target.x() > location.x()) {
+                location = { qMin(location.x() + speed, static_cast<qreal>(target.x())), location.y() };
+            }
+            else if (target.x() < location.x()) {
+                location = { qMax(location.x() - speed, static_cast<qreal>(target.x())), location.y() };
+            }
+            if (target.y() > location.y()) {
+                location = { location.x(), qMin(location.y() + speed, static_cast<qreal>(target.y())) };
+            }
+            else if (target.y() < location.y()) {
+                location = { location.x(), qMax(location.y() - speed, static_cast<qreal>(target.y())) };
+            }
+        }
+};
+
+class MotionHandlerTest : public QObject
+{
+        Q_OBJECT
+
+    private:
+        QList<QSharedPointer<Tile>> tiles;
+
+    public:
+        MotionHandlerTest() :
+            tiles()
+        {
+            for (int x(0); x < GRID_SIZE; ++x) {
+                for (int y(0); y < GRID_SIZE; ++y) {
+                    tiles.append(QSharedPointer<Tile>::create(x, y));
+                }
+            }
+        }
+
+    private:
+        const Tile& getTile(const int x, const int y) const
+        {
+            return *tiles.at(x * GRID_SIZE + y);
+        }
+
+        /**
+         * @brief Create a path going east along the first line of the grid.
+         */
+        QSharedPointer<PathInterface> createInitialPath() const
+        {
+            QList<const Tile*> path;
+            for (int x(0); x < GRID_SIZE; ++x) {
+                path.append(&getTile(x, 0));
+            }
+
+            return QSharedPointer<TilePath>::create(path);
+        }
+
+        /**
+         * @brief Create a path turning south from the given tile, which is the first step of the path.
+         */
+        QSharedPointer<PathInterface> createTurningPath(const Tile& origin) const
+        {
+            auto& coordinates(origin.coordinates());
+
+            return QSharedPointer<TilePath>::create(QList<const Tile*>({
+                &origin,
+                &getTile(coordinates.x(), 1),
+                &getTile(coordinates.x(), 2),
+                &getTile(coordinates.x() - 1, 3),
+                &getTile(coordinates.x() - 1, 4),
+            }));
+        }
+
+    private slots:
+        void test_trajectory_is_same_as_processing_characters_one_by_one_data()
+        {
+            QTest::addColumn<qreal>("speed");
+            QTest::addColumn<int>("pathChangeCycle");
+            QTest::addColumn<bool>("isPathChangedBeforeMotion");
+
+            // With a speed of 0.25, a tile is reached every 4 cycles.
+            QTest::newRow("Same path") << 0.1 << -1 << false;
+            QTest::newRow("Path taken before the motion") << 0.1 << 23 << true;
+            QTest::newRow("Path taken after the motion") << 0.1 << 23 << false;
+            QTest::newRow("Path taken before reaching a tile") << 0.25 << 8 << true;
+            QTest::newRow("Path taken once a tile is reached") << 0.25 << 8 << false;
+            QTest::newRow("Path taken right after reaching a tile") << 0.25 << 9 << true;
+            QTest::newRow("Path taken at the end of the path") << 0.25 << 44 << false;
+        }
+
+        void test_trajectory_is_same_as_processing_characters_one_by_one()
+        {
+            // Given
+            QFETCH(qreal, speed);
+            QFETCH(int, pathChangeCycle);
+            QFETCH(bool, isPathChangedBeforeMotion);
+            ReferenceMotion reference(speed, getTile(0, 0));
+            reference.takePath(createInitialPath());
+            MotionStore store;
+            MotionHandler handler(store, speed, getTile(0, 0));
+            handler.takePath(createInitialPath());
+            // The character is registered at the end of the cycle it was generated in.
+            handler.activate();
+
+            for (int cycle(1); cycle <= 150; ++cycle) {
+                // When
+                auto isPathChangeCycle(cycle == pathChangeCycle);
+                store.moveAll();
+                if (isPathChangeCycle && isPathChangedBeforeMotion) {
+                    QCOMPARE(&handler.getCurrentTile(), &reference.getCurrentTile());
+                    handler.takePath(createTurningPath(handler.getCurrentTile()));
+                    reference.takePath(createTurningPath(reference.getCurrentTile()));
+                }
+                handler.updateMotion();
+                reference.move();
+                if (isPathChangeCycle && !isPathChangedBeforeMotion) {
+                    QCOMPARE(&handler.getCurrentTile(), &reference.getCurrentTile());
+                    handler.takePath(createTurningPath(handler.getCurrentTile()));
+                    reference.takePath(createTurningPath(reference.getCurrentTile()));
+                }
+
+                // Then
+                QVERIFY2(
+                    handler.getCurrentLocation() == reference.getCurrentLocation(),
+                    qPrintable(QString("Trajectories diverge at cycle %1").arg(cycle))
+                );
+                QCOMPARE(&handler.getCurrentTile(), &reference.getCurrentTile());
+                QCOMPARE(handler.isPathCompleted(), reference.isPathCompleted());
+            }
+            QVERIFY(reference.isPathCompleted());
+        }
+};
+
+QTEST_MAIN(MotionHandlerTest)
+#include "MotionHandlerTest.moc"
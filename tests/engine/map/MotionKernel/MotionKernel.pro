@@ -0,0 +1,14 @@
+QT += core testlib
+QT -= gui
+
+TARGET = MotionKernelTest
+CONFIG += c++14 qt console warn_on depend_includepath testcase
+CONFIG -= app_bundle
+
+TEMPLATE = app
+
+INCLUDEPATH += ../../../..
+
+SOURCES += \
+    ../../../../src/engine/map/dynamicElement/MotionKernel.cpp \
+    MotionKernelTest.cpp
@@ -0,0 +1,166 @@
+#include <QtTest>
+#include <QtCore/QRandomGenerator>
+#include <QtCore/QVector>
+
+#include "src/engine/map/dynamicElement/MotionKernel.hpp"
+
+/**
+ * @brief A set of walkers, stored the same way than in the motion store.
+ */
+struct Walkers
+{
+    Walkers(const int count, const quint32 seed = 42) :
+        x(count),
+        y(count),
+        speed(count),
+        targetX(count),
+        targetY(count),
+        moved(count),
+        arrived(count)
+    {
+        QRandomGenerator generator(seed);
+        for (int i(0); i < count; ++i) {
+            x[i] = generator.bounded(0, 200);
+            y[i] = generator.bounded(0, 200);
+            // Some walkers are standing (no speed or no target), the others are moving toward a neighbour tile.
+            speed[i] = generator.bounded(0, 4) * 0.05;
+            targetX[i] = x[i] + generator.bounded(-1, 2);
+            targetY[i] = y[i] + generator.bounded(-1, 2);
+        }
+    }
+
+    MotionKernel::Batch batch()
+    {
+        return { x.data(), y.data(), speed.constData(), targetX.constData(), targetY.constData(), moved.data(), arrived.data(), x.size() };
+    }
+
+    QVector<qreal> x;
+    QVector<qreal> y;
+    QVector<qreal> speed;
+    QVector<qreal> targetX;
+    QVector<qreal> targetY;
+    QVector<quint8> moved;
+    QVector<quint8> arrived;
+};
+
+class MotionKernelTest : public QObject
+{
+        Q_OBJECT
+
+    private slots:
+        void test_walker_moves_toward_target_without_getting_past()
+        {
+            // Given
+            Walkers walkers(1);
+            walkers.x[0] = 2.0;
+            walkers.y[0] = 6.0;
+            walkers.speed[0] = 0.3;
+            walkers.targetX[0] = 3.0;
+            walkers.targetY[0] = 5.0;
+
+            // When
+            MotionKernel::moveScalar(walkers.batch());
+            MotionKernel::moveScalar(walkers.batch());
+
+            // Then
+            QCOMPARE(walkers.x[0], 2.6);
+            QCOMPARE(walkers.y[0], 5.4);
+            QCOMPARE(walkers.moved[0], quint8(true));
+            QCOMPARE(walkers.arrived[0], quint8(false));
+
+            // When
+            MotionKernel::moveScalar(walkers.batch());
+            MotionKernel::moveScalar(walkers.batch());
+
+            // Then
+            QCOMPARE(walkers.x[0], 3.0);
+            QCOMPARE(walkers.y[0], 5.0);
+            QCOMPARE(walkers.moved[0], quint8(true));
+            QCOMPARE(walkers.arrived[0], quint8(true));
+
+            // When
+            MotionKernel::moveScalar(walkers.batch());
+
+            // Then
+            QCOMPARE(walkers.moved[0], quint8(false));
+            QCOMPARE(walkers.arrived[0], quint8(false));
+        }
+
+
+
+        void test_vectorized_kernel_matches_scalar_kernel_data()
+        {
+            QTest::addColumn<int>("count");
+
+            QTest::newRow("empty") << 0;
+            QTest::newRow("smaller than a vector") << 3;
+            QTest::newRow("with remainder") << 1001;
+        }
+
+        void test_vectorized_kernel_matches_scalar_kernel()
+        {
+            // Given
+            QFETCH(int, count);
+            Walkers scalarWalkers(count);
+            Walkers vectorizedWalkers(count);
+
+            for (int step(0); step < 25; ++step) {
+                // When
+                MotionKernel::moveScalar(scalarWalkers.batch());
+                MotionKernel::moveVectorized(vectorizedWalkers.batch());
+
+                // Then
+                QCOMPARE(vectorizedWalkers.x, scalarWalkers.x);
+                QCOMPARE(vectorizedWalkers.y, scalarWalkers.y);
+                QCOMPARE(vectorizedWalkers.moved, scalarWalkers.moved);
+                QCOMPARE(vectorizedWalkers.arrived, scalarWalkers.arrived);
+            }
+        }
+
+
+
+        void benchmark_scalar_kernel_data()
+        {
+            benchmarkData("scalar");
+        }
+
+        void benchmark_scalar_kernel()
+        {
+            QFETCH(int, count);
+            Walkers walkers(count);
+
+            QBENCHMARK {
+                MotionKernel::moveScalar(walkers.batch());
+            }
+        }
+
+
+
+        void benchmark_vectorized_kernel_data()
+        {
+            benchmarkData(MotionKernel::getVectorizationName());
+        }
+
+        void benchmark_vectorized_kernel()
+        {
+            QFETCH(int, count);
+            Walkers walkers(count);
+
+            QBENCHMARK {
+                MotionKernel::moveVectorized(walkers.batch());
+            }
+        }
+
+    private:
+        void benchmarkData(const char* instructionSet)
+        {
+            QTest::addColumn<int>("count");
+
+            for (int count : { 1000, 10000, 100000 }) {
+                QTest::addRow("%d walkers, %s", count, instructionSet) << count;
+            }
+        }
+};
+
+QTEST_MAIN(MotionKernelTest)
+#include "MotionKernelTest.moc"
@@ -2,4 +2,6 @@
 TEMPLATE = subdirs
 
 SUBDIRS = \
-    MapCoordinates
+    MapCoordinates \
+    MotionHandler \
+    MotionKernel